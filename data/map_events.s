@@ -3,6 +3,7 @@
 #include "constants/event_objects.h"
 #include "constants/flags.h"
 #include "constants/items.h"
+#include "constants/map_events.h"
 #include "constants/map_scripts.h"
 #include "constants/maps.h"
 #include "constants/secret_bases.h"
@@ -42,6 +42,22 @@ static struct BgControl sGpuBgConfigs;
 static struct BgConfig2 sGpuBgConfigs2[NUM_BACKGROUNDS];
 static u32 sDmaBusyBitfield[NUM_BACKGROUNDS];
 
+// Rows of each text mode tilemap buffer (32 entries each, counted across all
+// screens) written since the last CopyBgTilemapBufferToVram. Only buffers
+// that opted in through TrackBgTilemapBufferWrites are uploaded partially,
+// since everything else may be written through the raw buffer pointer.
+struct BgTilemapDirtyRows
+{
+    bool8 tracked;
+    u8 top;
+    u8 bottom;
+};
+
+static struct BgTilemapDirtyRows sBgTilemapDirtyRows[NUM_BACKGROUNDS];
+
+static void MarkBgTilemapRowsDirty(u8 bg, u32 top, u32 bottom);
+static void MarkAllBgTilemapRowsDirty(u8 bg);
+
 u32 gUnneededFireRedVariable;
 
 static const struct BgConfig sZeroedBgControlStruct = { 0 };
@@ -851,6 +867,20 @@ void SetBgTilemapBuffer(u8 bg, void *tilemap)
     if (!IsInvalidBg32(bg) && GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
     {
         sGpuBgConfigs2[bg].tilemap = tilemap;
+        sBgTilemapDirtyRows[bg].tracked = FALSE;
+        MarkAllBgTilemapRowsDirty(bg);
+    }
+}
+
+// For tilemap buffers that are only ever written through the functions in this
+// file, such as the ones allocated by the window system. CopyBgTilemapBufferToVram
+// will then only upload the rows that changed.
+void TrackBgTilemapBufferWrites(u8 bg)
+{
+    if (!IsInvalidBg32(bg) && GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
+    {
+        sBgTilemapDirtyRows[bg].tracked = TRUE;
+        MarkAllBgTilemapRowsDirty(bg);
     }
 }
 
@@ -859,6 +889,7 @@ void UnsetBgTilemapBuffer(u8 bg)
     if (!IsInvalidBg32(bg) && GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
     {
         sGpuBgConfigs2[bg].tilemap = NULL;
+        sBgTilemapDirtyRows[bg].tracked = FALSE;
     }
 }
 
@@ -868,8 +899,10 @@ void* GetBgTilemapBuffer(u8 bg)
         return NULL;
     else if (!GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
         return NULL;
-    else
-        return sGpuBgConfigs2[bg].tilemap;
+
+    // The caller may write through this pointer at any time.
+    sBgTilemapDirtyRows[bg].tracked = FALSE;
+    return sGpuBgConfigs2[bg].tilemap;
 }
 
 void CopyToBgTilemapBuffer(u8 bg, const void *src, u16 mode, u16 destOffset)
@@ -880,19 +913,32 @@ void CopyToBgTilemapBuffer(u8 bg, const void *src, u16 mode, u16 destOffset)
             CpuCopy16(src, (void *)(sGpuBgConfigs2[bg].tilemap + (destOffset * 2)), mode);
         else
             LZ77UnCompWram(src, (void *)(sGpuBgConfigs2[bg].tilemap + (destOffset * 2)));
+        MarkAllBgTilemapRowsDirty(bg);
     }
 }
 
 void CopyBgTilemapBufferToVram(u8 bg)
 {
     u16 sizeToLoad;
+    u16 offset = 0;
+    struct BgTilemapDirtyRows *dirty;
 
     if (!IsInvalidBg32(bg) && !IsTileMapOutsideWram(bg))
     {
+        dirty = &sBgTilemapDirtyRows[bg];
         switch (GetBgType(bg))
         {
         case 0:
+            // A tracked buffer with nothing dirty is still uploaded whole, since
+            // callers also use this to restore a tilemap overwritten in VRAM.
             sizeToLoad = GetBgMetricTextMode(bg, 0) * 0x800;
+            if (dirty->tracked && dirty->top <= dirty->bottom)
+            {
+                offset = dirty->top * 0x40;
+                if ((dirty->bottom + 1) * 0x40 < sizeToLoad)
+                    sizeToLoad = (dirty->bottom + 1) * 0x40;
+                sizeToLoad -= offset;
+            }
             break;
         case 1:
             sizeToLoad = GetBgMetricAffineMode(bg, 0) * 0x100;
@@ -901,7 +947,11 @@ void CopyBgTilemapBufferToVram(u8 bg)
             sizeToLoad = 0;
             break;
         }
-        LoadBgVram(bg, sGpuBgConfigs2[bg].tilemap, sizeToLoad, 0, 2);
+        if (LoadBgVram(bg, sGpuBgConfigs2[bg].tilemap + offset, sizeToLoad, offset, 2) != 0xFF)
+        {
+            dirty->top = 0xFF;
+            dirty->bottom = 0;
+        }
     }
 }
 
@@ -925,6 +975,7 @@ void CopyToBgTilemapBufferRect(u8 bg, const void* src, u8 destX, u8 destY, u8 wi
                     ((u16*)sGpuBgConfigs2[bg].tilemap)[((destY16 * 0x20) + destX16)] = *srcCopy++;
                 }
             }
+            MarkBgTilemapRowsDirty(bg, destY, destY + height - 1);
             break;
         }
         case 1:
@@ -938,6 +989,7 @@ void CopyToBgTilemapBufferRect(u8 bg, const void* src, u8 destX, u8 destY, u8 wi
                     ((u8*)sGpuBgConfigs2[bg].tilemap)[((destY16 * mode) + destX16)] = *srcCopy++;
                 }
             }
+            MarkAllBgTilemapRowsDirty(bg);
             break;
         }
         }
@@ -955,6 +1007,7 @@ void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8
     u16 var;
     const void *srcPtr;
     u16 i, j;
+    u16 minIndex = 0xFFFF, maxIndex = 0;
 
     if (!IsInvalidBg32(bg) && !IsTileMapOutsideWram(bg))
     {
@@ -971,10 +1024,16 @@ void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8
                 {
                     u16 index = GetTileMapIndexFromCoords(j, i, screenSize, screenWidth, screenHeight);
                     CopyTileMapEntry(srcPtr, sGpuBgConfigs2[bg].tilemap + (index * 2), rectHeight, palette1, tileOffset);
+                    if (index < minIndex)
+                        minIndex = index;
+                    if (index > maxIndex)
+                        maxIndex = index;
                     srcPtr += 2;
                 }
                 srcPtr += (srcWidth - destY) * 2;
             }
+            if (minIndex <= maxIndex)
+                MarkBgTilemapRowsDirty(bg, minIndex / 0x20, maxIndex / 0x20);
             break;
         case 1:
             srcPtr = src + ((srcY * srcWidth) + srcX);
@@ -988,6 +1047,7 @@ void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8
                 }
                 srcPtr += (srcWidth - destY);
             }
+            MarkAllBgTilemapRowsDirty(bg);
             break;
         }
     }
@@ -1011,6 +1071,7 @@ void FillBgTilemapBufferRect_Palette0(u8 bg, u16 tileNum, u8 x, u8 y, u8 width,
                     ((u16*)sGpuBgConfigs2[bg].tilemap)[((y16 * 0x20) + x16)] = tileNum;
                 }
             }
+            MarkBgTilemapRowsDirty(bg, y, y + height - 1);
             break;
         case 1:
             mode = GetBgMetricAffineMode(bg, 0x1);
@@ -1021,6 +1082,7 @@ void FillBgTilemapBufferRect_Palette0(u8 bg, u16 tileNum, u8 x, u8 y, u8 width,
                     ((u8*)sGpuBgConfigs2[bg].tilemap)[((y16 * mode) + x16)] = tileNum;
                 }
             }
+            MarkAllBgTilemapRowsDirty(bg);
             break;
         }
     }
@@ -1038,6 +1100,8 @@ void WriteSequenceToBgTilemapBuffer(u8 bg, u16 firstTileNum, u8 x, u8 y, u8 widt
     u16 attribute;
     u16 mode3;
     u16 x16, y16;
+    u16 index;
+    u16 minIndex = 0xFFFF, maxIndex = 0;
 
     if (!IsInvalidBg32(bg) && !IsTileMapOutsideWram(bg))
     {
@@ -1051,10 +1115,17 @@ void WriteSequenceToBgTilemapBuffer(u8 bg, u16 firstTileNum, u8 x, u8 y, u8 widt
             {
                 for (x16 = x; x16 < (x + width); x16++)
                 {
-                    CopyTileMapEntry(&firstTileNum, &((u16*)sGpuBgConfigs2[bg].tilemap)[(u16)GetTileMapIndexFromCoords(x16, y16, attribute, mode, mode2)], paletteSlot, 0, 0);
+                    index = GetTileMapIndexFromCoords(x16, y16, attribute, mode, mode2);
+                    CopyTileMapEntry(&firstTileNum, &((u16*)sGpuBgConfigs2[bg].tilemap)[index], paletteSlot, 0, 0);
                     firstTileNum = (firstTileNum & (METATILE_COLLISION_MASK | METATILE_ELEVATION_MASK)) + ((firstTileNum + tileNumDelta) & METATILE_ID_MASK);
+                    if (index < minIndex)
+                        minIndex = index;
+                    if (index > maxIndex)
+                        maxIndex = index;
                 }
             }
+            if (minIndex <= maxIndex)
+                MarkBgTilemapRowsDirty(bg, minIndex / 0x20, maxIndex / 0x20);
             break;
         case 1:
             mode3 = GetBgMetricAffineMode(bg, 0x1);
@@ -1066,6 +1137,7 @@ void WriteSequenceToBgTilemapBuffer(u8 bg, u16 firstTileNum, u8 x, u8 y, u8 widt
                     firstTileNum = (firstTileNum & (METATILE_COLLISION_MASK | METATILE_ELEVATION_MASK)) + ((firstTileNum + tileNumDelta) & METATILE_ID_MASK);
                 }
             }
+            MarkAllBgTilemapRowsDirty(bg);
             break;
         }
     }
@@ -1237,6 +1309,28 @@ bool32 IsInvalidBg32(u8 bg)
         return FALSE;
 }
 
+static void MarkBgTilemapRowsDirty(u8 bg, u32 top, u32 bottom)
+{
+    struct BgTilemapDirtyRows *dirty = &sBgTilemapDirtyRows[bg];
+
+    // Text mode tilemaps are at most 4 screens, or 128 rows.
+    if (bottom >= 0x80)
+        bottom = 0x7F;
+    if (top > bottom)
+        return;
+
+    if (top < dirty->top)
+        dirty->top = top;
+    if (bottom > dirty->bottom)
+        dirty->bottom = bottom;
+}
+
+static void MarkAllBgTilemapRowsDirty(u8 bg)
+{
+    sBgTilemapDirtyRows[bg].top = 0;
+    sBgTilemapDirtyRows[bg].bottom = 0x7F;
+}
+
 bool32 IsTileMapOutsideWram(u8 bg)
 {
     if (sGpuBgConfigs2[bg].tilemap > (void*)IWRAM_END)
@@ -536,6 +536,8 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
             GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY + 8, glyphPixels + 24, glyphWidth - 8, glyphHeight - 8);
         }
     }
+
+    MarkWindowPixelRectDirty(textPrinter->printerTemplate.windowId, currX, currY, glyphWidth, glyphHeight);
 }
 
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width)
@@ -562,6 +564,7 @@ void ClearTextSpan(struct TextPrinter *textPrinter, u32 width)
             width,
             *glyphHeight,
             gLastTextBgColor);
+        MarkWindowPixelRectDirty(textPrinter->printerTemplate.windowId, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, width, *glyphHeight);
     }
 }
 
@@ -18,8 +18,23 @@ EWRAM_DATA struct Window gWindows[WINDOWS_MAX] = {0};
 EWRAM_DATA static struct Window* sWindowPtr = NULL;
 EWRAM_DATA static u16 sWindowSize = 0;
 
+// Span of tiles in each window's tileData that was written since the last
+// CopyWindowToVram, so only that span needs to be queued to DMA.
+// A window whose tileData pointer has been handed out can be written behind
+// our back, so it stops being tracked and is always uploaded whole.
+struct WindowDirtyTiles
+{
+    u16 start;
+    u16 end;
+    bool8 tracked;
+};
+
+EWRAM_DATA static struct WindowDirtyTiles sWindowDirtyTiles[WINDOWS_MAX] = {0};
+
 static u8 GetNumActiveWindowsOnBg(u8 bgId);
 static u8 GetNumActiveWindowsOnBg8Bit(u8 bgId);
+static void ResetWindowDirtyTiles(u8 windowId, bool8 tracked);
+static void MarkAllWindowTilesDirty(u8 windowId);
 
 static const struct WindowTemplate sDummyWindowTemplate = DUMMY_WIN_TEMPLATE;
 
@@ -51,6 +66,7 @@ bool16 InitWindows(const struct WindowTemplate *templates)
     {
         gWindows[i].window = sDummyWindowTemplate;
         gWindows[i].tileData = NULL;
+        ResetWindowDirtyTiles(i, FALSE);
     }
 
     for (i = 0, allocatedBaseBlock = 0, bgLayer = templates[i].bg; bgLayer != 0xFF && i < WINDOWS_MAX; ++i, bgLayer = templates[i].bg)
@@ -81,6 +97,7 @@ bool16 InitWindows(const struct WindowTemplate *templates)
 
                 gWindowBgTilemapBuffers[bgLayer] = allocatedTilemapBuffer;
                 SetBgTilemapBuffer(bgLayer, allocatedTilemapBuffer);
+                TrackBgTilemapBufferWrites(bgLayer);
             }
         }
 
@@ -99,6 +116,7 @@ bool16 InitWindows(const struct WindowTemplate *templates)
 
         gWindows[i].tileData = allocatedTilemapBuffer;
         gWindows[i].window = templates[i];
+        ResetWindowDirtyTiles(i, TRUE);
 
         if (gUnneededFireRedVariable == 1)
         {
@@ -156,6 +174,7 @@ u16 AddWindow(const struct WindowTemplate *template)
 
             gWindowBgTilemapBuffers[bgLayer] = allocatedTilemapBuffer;
             SetBgTilemapBuffer(bgLayer, allocatedTilemapBuffer);
+            TrackBgTilemapBufferWrites(bgLayer);
         }
     }
 
@@ -173,6 +192,7 @@ u16 AddWindow(const struct WindowTemplate *template)
 
     gWindows[win].tileData = allocatedTilemapBuffer;
     gWindows[win].window = *template;
+    ResetWindowDirtyTiles(win, TRUE);
 
     if (gUnneededFireRedVariable == 1)
     {
@@ -210,6 +230,7 @@ int AddWindowWithoutTileMap(const struct WindowTemplate *template)
     }
 
     gWindows[win].window = *template;
+    ResetWindowDirtyTiles(win, FALSE);
 
     if (gUnneededFireRedVariable == 1)
     {
@@ -230,6 +251,7 @@ void RemoveWindow(u8 windowId)
     }
 
     gWindows[windowId].window = sDummyWindowTemplate;
+    ResetWindowDirtyTiles(windowId, FALSE);
 
     if (GetNumActiveWindowsOnBg(bgLayer) == 0)
     {
@@ -270,22 +292,48 @@ void FreeAllWindowBuffers(void)
     }
 }
 
+// Queues the tiles written since the last copy. A tracked window with nothing
+// dirty is still uploaded whole, since callers also use this to restore
+// window graphics after something else has overwritten them in VRAM.
+static void LoadWindowDirtyTiles(u8 windowId)
+{
+    struct Window *window = &gWindows[windowId];
+    struct WindowDirtyTiles *dirty = &sWindowDirtyTiles[windowId];
+    u16 start, end;
+
+    if (dirty->tracked && dirty->start < dirty->end)
+    {
+        start = dirty->start;
+        end = dirty->end;
+    }
+    else
+    {
+        start = 0;
+        end = window->window.width * window->window.height;
+    }
+
+    if (LoadBgTiles(window->window.bg, window->tileData + (start * 32), (end - start) * 32, window->window.baseBlock + start) != 0xFFFF)
+    {
+        dirty->start = 0;
+        dirty->end = 0;
+    }
+}
+
 void CopyWindowToVram(u8 windowId, u8 mode)
 {
-    struct Window windowLocal = gWindows[windowId];
-    u16 windowSize = 32 * (windowLocal.window.width * windowLocal.window.height);
+    u8 bg = gWindows[windowId].window.bg;
 
     switch (mode)
     {
     case 1:
-        CopyBgTilemapBufferToVram(windowLocal.window.bg);
+        CopyBgTilemapBufferToVram(bg);
         break;
     case 2:
-        LoadBgTiles(windowLocal.window.bg, windowLocal.tileData, windowSize, windowLocal.window.baseBlock);
+        LoadWindowDirtyTiles(windowId);
         break;
     case 3:
-        LoadBgTiles(windowLocal.window.bg, windowLocal.tileData, windowSize, windowLocal.window.baseBlock);
-        CopyBgTilemapBufferToVram(windowLocal.window.bg);
+        LoadWindowDirtyTiles(windowId);
+        CopyBgTilemapBufferToVram(bg);
         break;
     }
 }
@@ -416,6 +464,7 @@ void BlitBitmapRectToWindow(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u
     destRect.height = 8 * gWindows[windowId].window.height;
 
     BlitBitmapRect4Bit(&sourceRect, &destRect, srcX, srcY, destX, destY, rectWidth, rectHeight, 0);
+    MarkWindowPixelRectDirty(windowId, destX, destY, rectWidth, rectHeight);
 }
 
 static void BlitBitmapRectToWindowWithColorKey(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u16 srcWidth, int srcHeight, u16 destX, u16 destY, u16 rectWidth, u16 rectHeight, u8 colorKey)
@@ -432,6 +481,7 @@ static void BlitBitmapRectToWindowWithColorKey(u8 windowId, const u8 *pixels, u1
     destRect.height = 8 * gWindows[windowId].window.height;
 
     BlitBitmapRect4Bit(&sourceRect, &destRect, srcX, srcY, destX, destY, rectWidth, rectHeight, colorKey);
+    MarkWindowPixelRectDirty(windowId, destX, destY, rectWidth, rectHeight);
 }
 
 void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16 height)
@@ -443,6 +493,7 @@ void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16
     pixelRect.height = 8 * gWindows[windowId].window.height;
 
     FillBitmapRect4Bit(&pixelRect, x, y, width, height, fillValue);
+    MarkWindowPixelRectDirty(windowId, x, y, width, height);
 }
 
 void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOffset)
@@ -451,6 +502,7 @@ void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOff
         CpuCopy16(src, gWindows[windowId].tileData + (32 * tileOffset), size);
     else
         LZ77UnCompWram(src, gWindows[windowId].tileData + (32 * tileOffset));
+    MarkAllWindowTilesDirty(windowId);
 }
 
 // Sets all pixels within the window to the fillValue color.
@@ -458,6 +510,61 @@ void FillWindowPixelBuffer(u8 windowId, u8 fillValue)
 {
     int fillSize = gWindows[windowId].window.width * gWindows[windowId].window.height;
     CpuFastFill8(fillValue, gWindows[windowId].tileData, 32 * fillSize);
+    MarkAllWindowTilesDirty(windowId);
+}
+
+// Records that the given pixel rect of the window's tileData has been written,
+// for callers that draw into gWindows[windowId].tileData directly.
+void MarkWindowPixelRectDirty(u8 windowId, u16 x, u16 y, u16 width, u16 height)
+{
+    struct WindowDirtyTiles *dirty = &sWindowDirtyTiles[windowId];
+    u32 windowWidth = gWindows[windowId].window.width;
+    u32 windowHeight = gWindows[windowId].window.height;
+    u32 left, top, right, bottom;
+    u16 start, end;
+
+    if (width == 0 || height == 0)
+        return;
+
+    left = x / 8;
+    top = y / 8;
+    right = (x + width - 1) / 8;
+    bottom = (y + height - 1) / 8;
+
+    if (left >= windowWidth || top >= windowHeight)
+        return;
+    if (right >= windowWidth)
+        right = windowWidth - 1;
+    if (bottom >= windowHeight)
+        bottom = windowHeight - 1;
+
+    start = (top * windowWidth) + left;
+    end = (bottom * windowWidth) + right + 1;
+
+    if (dirty->start >= dirty->end)
+    {
+        dirty->start = start;
+        dirty->end = end;
+    }
+    else
+    {
+        if (start < dirty->start)
+            dirty->start = start;
+        if (end > dirty->end)
+            dirty->end = end;
+    }
+}
+
+static void MarkAllWindowTilesDirty(u8 windowId)
+{
+    sWindowDirtyTiles[windowId].start = 0;
+    sWindowDirtyTiles[windowId].end = gWindows[windowId].window.width * gWindows[windowId].window.height;
+}
+
+static void ResetWindowDirtyTiles(u8 windowId, bool8 tracked)
+{
+    sWindowDirtyTiles[windowId].tracked = tracked;
+    MarkAllWindowTilesDirty(windowId);
 }
 
 #define MOVE_TILES_DOWN(a)                                                      \
@@ -527,6 +634,8 @@ void ScrollWindow(u8 windowId, u8 direction, u8 distance, u8 fillValue)
     case 2:
         break;
     }
+
+    MarkAllWindowTilesDirty(windowId);
 }
 
 void CallWindowFunction(u8 windowId, void ( *func)(u8, u8, u8, u8, u8, u8))
@@ -553,6 +662,7 @@ bool8 SetWindowAttribute(u8 windowId, u8 attributeId, u32 value)
         return FALSE;
     case WINDOW_TILE_DATA:
         gWindows[windowId].tileData = (u8*)(value);
+        sWindowDirtyTiles[windowId].tracked = FALSE;
         return TRUE;
     case WINDOW_BG:
     case WINDOW_WIDTH:
@@ -581,6 +691,8 @@ u32 GetWindowAttribute(u8 windowId, u8 attributeId)
     case WINDOW_BASE_BLOCK:
         return gWindows[windowId].window.baseBlock;
     case WINDOW_TILE_DATA:
+        // The caller may write through this pointer at any time.
+        sWindowDirtyTiles[windowId].tracked = FALSE;
         return (u32)(gWindows[windowId].tileData);
     default:
         return 0;
@@ -631,6 +743,7 @@ u16 AddWindow8Bit(const struct WindowTemplate *template)
                 memAddress[i] = 0;
             gWindowBgTilemapBuffers[bgLayer] = memAddress;
             SetBgTilemapBuffer(bgLayer, memAddress);
+            TrackBgTilemapBufferWrites(bgLayer);
         }
     }
     memAddress = Alloc((u16)(64 * (template->width * template->height)));
@@ -647,6 +760,7 @@ u16 AddWindow8Bit(const struct WindowTemplate *template)
     {
         gWindows[windowId].tileData = memAddress;
         gWindows[windowId].window = *template;
+        ResetWindowDirtyTiles(windowId, FALSE);
         return windowId;
     }
 }
@@ -61,6 +61,7 @@ void BlitBitmapRectToWindow(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u
 void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16 height);
 void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOffset);
 void FillWindowPixelBuffer(u8 windowId, u8 fillValue);
+void MarkWindowPixelRectDirty(u8 windowId, u16 x, u16 y, u16 width, u16 height);
 void ScrollWindow(u8 windowId, u8 direction, u8 distance, u8 fillValue);
 void CallWindowFunction(u8 windowId, void ( *func)(u8, u8, u8, u8, u8, u8));
 bool8 SetWindowAttribute(u8 windowId, u8 attributeId, u32 value);
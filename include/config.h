@@ -15,6 +15,19 @@
 // printing system. Use NoCashGBAPrint() and NoCashGBAPrintf() like you
 // would normally use AGBPrint() and AGBPrintf().
 
+// Uncomment to count executions of each script command and special, the frames
+// scripts spend waiting, and the time spent under each script label. Reports are
+// printed with AGBPrintf, so NDEBUG must be commented out as well. Call the
+// ScriptProfilerReport special to dump the counters and feed the output to
+// tools/scriptprof along with the .sym file to get label names, and the
+// ScriptProfilerReset special to start counting afresh.
+//#define SCRIPT_PROFILER
+
+// Uncomment to count how many battle animation sprite sheet loads are served by
+// the sheets battle_anim.c keeps resident. The counts for a battle are printed
+// with AGBPrintf when the next one starts, so NDEBUG must be commented out as well.
+//#define ANIM_GFX_CACHE_STATS
+
 #define ENGLISH
 
 #ifdef ENGLISH
@@ -169,5 +169,6 @@
 #define B_NEW_SURF_PARTICLE_PALETTE     FALSE    // If set to TRUE, it updates Surf's wave palette.
 
 #define B_ENABLE_DEBUG                  FALSE    // If set to TRUE, enables a debug menu to use in battles by pressing the Select button.
+#define B_ABILITY_CACHE_DEBUG           FALSE    // If set to TRUE, every GetBattlerAbility call is checked against the uncached evaluation. Needs NDEBUG to be undefined.
 
 #endif // GUARD_CONSTANTS_BATTLE_CONFIG_H
@@ -0,0 +1,9 @@
+#ifndef GUARD_CONSTANTS_MAP_EVENTS_H
+#define GUARD_CONSTANTS_MAP_EVENTS_H
+
+// Event kinds in a map's position index (see struct MapEventPosition)
+#define MAP_EVENT_POSITION_WARP  0
+#define MAP_EVENT_POSITION_COORD 1
+#define MAP_EVENT_POSITION_BG    2
+
+#endif // GUARD_CONSTANTS_MAP_EVENTS_H
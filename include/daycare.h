@@ -3,6 +3,13 @@
 
 #include "constants/daycare.h"
 
+// Where a species' egg moves are in gEggMoves. Generated by tools/lookupgen.
+struct EggMovesIndex
+{
+    u16 offset;
+    u8 count;
+};
+
 u8 *GetMonNickname2(struct Pokemon *mon, u8 *dest);
 u8 *GetBoxMonNickname(struct BoxPokemon *mon, u8 *dest);
 u8 CountPokemonInDaycare(struct DayCare *daycare);
@@ -103,6 +103,15 @@ struct BgEvent
     } bgUnion;
 };
 
+// Generated by mapjson. Sorted by y, then x, with one entry per warp, coord and bg event.
+struct MapEventPosition
+{
+    u16 x;
+    u16 y;
+    u8 kind;
+    u8 index;
+};
+
 struct MapEvents
 {
     u8 objectEventCount;
@@ -113,6 +122,7 @@ struct MapEvents
     struct WarpEvent *warps;
     struct CoordEvent *coordEvents;
     struct BgEvent *bgEvents;
+    const struct MapEventPosition *positions; // warpCount + coordEventCount + bgEventCount entries, or NULL
 };
 
 struct MapConnection
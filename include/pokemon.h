@@ -124,6 +124,17 @@ struct Pokemon
     u16 spDefense;
 };
 
+// A BoxPokemon with its secure block decrypted and validated once, so that many fields can be
+// read or written without a decrypt/checksum/encrypt cycle each. Writes to encrypted fields
+// are stored back by CommitDecodedBoxMon. Personality and OT ID must not change while decoded.
+struct DecodedBoxMon
+{
+    struct BoxPokemon *boxMon;
+    union PokemonSubstruct substructs[4];
+    bool8 isValid;
+    bool8 modified;
+};
+
 struct Unknown_806F160_Struct
 {
     u32 field_0_0:4;
@@ -251,6 +262,13 @@ struct Evolution
     u16 targetSpecies;
 };
 
+struct EvolutionFamily
+{
+    u16 root;  // the first stage, which eggs of the family hatch into
+    u16 final; // reached by following the first evolution, ignoring Mega Evolution
+    u8 stage;  // 0 for the root, 1 for its evolutions, and so on
+};
+
 struct FormChange {
     u16 method;
     u16 targetSpecies;
@@ -281,6 +299,8 @@ extern const struct BaseStats gBaseStats[];
 extern const u8 *const gItemEffectTable[];
 extern const u32 gExperienceTables[][MAX_LEVEL + 1];
 extern const struct Evolution gEvolutionTable[NUM_SPECIES][EVOS_PER_MON];
+extern const u16 gPreEvolutionTable[NUM_SPECIES];
+extern const struct EvolutionFamily gEvolutionFamily[NUM_SPECIES];
 extern const struct LevelUpMove *const gLevelUpLearnsets[];
 extern const u8 gPPUpGetMask[];
 extern const u8 gPPUpSetMask[];
@@ -317,6 +337,7 @@ void CalculateMonStats(struct Pokemon *mon);
 void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest);
 u8 GetLevelFromMonExp(struct Pokemon *mon);
 u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon);
+u8 GetLevelFromDecodedBoxMonExp(struct DecodedBoxMon *decoded);
 u16 GiveMoveToMon(struct Pokemon *mon, u16 move);
 u16 GiveMoveToBoxMon(struct BoxPokemon *boxMon, u16 move);
 u16 GiveMoveToBattleMon(struct BattlePokemon *mon, u16 move);
@@ -355,6 +376,10 @@ u32 GetBoxMonData();
 
 void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg);
 void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg);
+void DecodeBoxMon(struct BoxPokemon *boxMon, struct DecodedBoxMon *decoded);
+u32 GetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, u8 *data);
+void SetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, const void *dataArg);
+void CommitDecodedBoxMon(struct DecodedBoxMon *decoded);
 void CopyMon(void *dest, void *src, size_t size);
 u8 GiveMonToPlayer(struct Pokemon *mon);
 u8 SendMonToPC(struct Pokemon* mon);
@@ -386,6 +411,10 @@ u8 *UseStatIncreaseItem(u16 itemId);
 u8 GetNature(struct Pokemon *mon);
 u8 GetNatureFromPersonality(u32 personality);
 u16 GetEvolutionTargetSpecies(struct Pokemon *mon, u8 type, u16 evolutionItem, u16 tradePartnerSpecies);
+u16 GetPreEvolution(u16 species);
+u16 GetEvolutionFamilyRoot(u16 species);
+u8 GetEvolutionStage(u16 species);
+u16 GetFinalEvolution(u16 species);
 u16 HoennPokedexNumToSpecies(u16 hoennNum);
 u16 NationalPokedexNumToSpecies(u16 nationalNum);
 u16 NationalToHoennOrder(u16 nationalNum);
@@ -17,6 +17,15 @@ struct ScriptContext
     ScrCmdFunc *cmdTable;
     ScrCmdFunc *cmdTableEnd;
     u32 data[4];
+#ifdef SCRIPT_PROFILER
+    const u8 *profileEntry;
+    const u8 *profileScript; // label the current commands are attributed to
+    const u8 *profileStack[20];
+    u32 profileRunStart;
+    u32 profileRunCommands;
+    u32 profileRunScanlines;
+    u8 profileLastCmd;
+#endif
 };
 
 #define ScriptReadByte(ctx) (*(ctx->scriptPtr++))
@@ -58,6 +67,14 @@ const u8 *GetRamScript(u8 objectId, const u8 *script);
 bool32 ValidateSavedRamScript(void);
 u8 *GetSavedRamScriptIfValid(void);
 void InitRamScript_NoObjectEvent(u8 *script, u16 scriptSize);
+void ScriptProfilerReport(void);
+void ScriptProfilerReset(void);
+
+#ifdef SCRIPT_PROFILER
+void ScriptProfiler_CountSpecial(u16 index);
+#else
+#define ScriptProfiler_CountSpecial(index)
+#endif
 
 // srccmd.h
 void SetMovingNpcId(u16 npcId);
@@ -5,5 +5,6 @@ void InitTilesetAnimations(void);
 void InitSecondaryTilesetAnimation(void);
 void UpdateTilesetAnimations(void);
 void TransferTilesetAnimsBuffer(void);
+void InvalidateVisibleAnimTiles(void);
 
 #endif // GUARD_TILESET_ANIMS_H
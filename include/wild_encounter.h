@@ -7,6 +7,9 @@
 #define FISH_WILD_COUNT     10
 #define HONEY_WILD_COUNT    6
 
+// Randomizer BST floor, increases early game variety and reduces the chance to abuse Cosmog and Feebas
+#define RANDOMIZER_MIN_BST 250
+
 struct WildPokemon
 {
     u8 minLevel;
@@ -51,5 +54,6 @@ bool8 UpdateRepelCounter(void);
 bool8 TryDoDoubleWildBattle(void);
 void HoneyWildEncounter(void);
 u16 GetCurrentMapWildMonHeaderId(void);
+u16 GetRandomWildEncounterWithBST(u16 species);
 
 #endif // GUARD_WILD_ENCOUNTER_H
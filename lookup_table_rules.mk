@@ -0,0 +1,28 @@
+# Lookup tables that are precomputed from the species data by lookupgen, a host tool that
+# is compiled against the game's data headers. Rebuilding the tool rewrites the tables.
+
+LOOKUP_TABLES :=
+
+LOOKUP_TABLES += $(DATA_SRC_SUBDIR)/pokemon/egg_moves_index.h
+$(DATA_SRC_SUBDIR)/pokemon/egg_moves_index.h: $(LOOKUPGEN)
+	$(LOOKUPGEN) eggmoves $@
+
+$(C_BUILDDIR)/daycare.o: c_dep += $(DATA_SRC_SUBDIR)/pokemon/egg_moves_index.h
+
+LOOKUP_TABLES += $(DATA_SRC_SUBDIR)/pokemon/evolution_families.h
+$(DATA_SRC_SUBDIR)/pokemon/evolution_families.h: $(LOOKUPGEN)
+	$(LOOKUPGEN) evolution $@
+
+$(C_BUILDDIR)/pokemon.o: c_dep += $(DATA_SRC_SUBDIR)/pokemon/evolution_families.h
+
+LOOKUP_TABLES += $(DATA_SRC_SUBDIR)/wild_encounter_randomizer_table.h
+$(DATA_SRC_SUBDIR)/wild_encounter_randomizer_table.h: $(LOOKUPGEN)
+	$(LOOKUPGEN) randomizer $@
+
+$(C_BUILDDIR)/wild_encounter_randomizer.o: c_dep += $(DATA_SRC_SUBDIR)/wild_encounter_randomizer_table.h
+
+AUTO_GEN_TARGETS += $(LOOKUP_TABLES)
+
+# Checks the generated tables and the code that reads them against the table scans they replaced.
+check: $(LOOKUP_TABLES)
+	@$(MAKE) -C tools/indexcheck check
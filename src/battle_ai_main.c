@@ -146,15 +146,22 @@ void BattleAI_SetupFlags(void)
         AI_THINKING_STRUCT->aiFlags |= AI_FLAG_DOUBLE_BATTLE; // Act smart in doubles and don't attack your partner.
 }
 
-void BattleAI_SetupAIData(u8 defaultScoreMoves)
+// Clears the per-target AI state and resets the move scores, leaving the
+// flags and the simulated damage matrix untouched.
+static u8 BattleAI_ResetScores(u8 defaultScoreMoves)
 {
-    s32 i, move, dmg;
+    s32 i;
     u8 moveLimitations;
 
-    // Clear AI data but preserve the flags.
-    u32 flags = AI_THINKING_STRUCT->aiFlags;
-    memset(AI_THINKING_STRUCT, 0, sizeof(struct AI_ThinkingStruct));
-    AI_THINKING_STRUCT->aiFlags = flags;
+    memset(AI_DATA, 0, sizeof(struct AiLogicData));
+    memset(AI_THINKING_STRUCT->saved, 0, sizeof(AI_THINKING_STRUCT->saved));
+    AI_THINKING_STRUCT->aiState = 0;
+    AI_THINKING_STRUCT->movesetIndex = 0;
+    AI_THINKING_STRUCT->moveConsidered = MOVE_NONE;
+    AI_THINKING_STRUCT->funcResult = 0;
+    AI_THINKING_STRUCT->aiAction = 0;
+    AI_THINKING_STRUCT->aiLogicId = 0;
+    AI_THINKING_STRUCT->switchMon = FALSE;
 
     // Conditional score reset, unlike Ruby.
     for (i = 0; i < MAX_MON_MOVES; i++)
@@ -176,8 +183,15 @@ void BattleAI_SetupAIData(u8 defaultScoreMoves)
             AI_THINKING_STRUCT->score[i] = 0;
     }
 
-    sBattler_AI = gActiveBattler;
-    // Simulate dmg for all AI moves against all other targets
+    return moveLimitations;
+}
+
+// Simulate dmg for all AI moves against all other targets.
+// This is done once per decision, every target and logic pass reads the results.
+static void BattleAI_SimulateDamage(u8 moveLimitations)
+{
+    s32 i, move, dmg;
+
     for (gBattlerTarget = 0; gBattlerTarget < gBattlersCount; gBattlerTarget++)
     {
         if (sBattler_AI == gBattlerTarget)
@@ -196,6 +210,21 @@ void BattleAI_SetupAIData(u8 defaultScoreMoves)
             AI_THINKING_STRUCT->simulatedDmg[sBattler_AI][gBattlerTarget][i] = dmg;
         }
     }
+}
+
+void BattleAI_SetupAIData(u8 defaultScoreMoves)
+{
+    u8 moveLimitations;
+
+    // Clear AI data but preserve the flags.
+    u32 flags = AI_THINKING_STRUCT->aiFlags;
+    memset(AI_THINKING_STRUCT, 0, sizeof(struct AI_ThinkingStruct));
+    AI_THINKING_STRUCT->aiFlags = flags;
+
+    moveLimitations = BattleAI_ResetScores(defaultScoreMoves);
+
+    sBattler_AI = gActiveBattler;
+    BattleAI_SimulateDamage(moveLimitations);
 
     gBattlerTarget = SetRandomTarget(sBattler_AI);
 }
@@ -366,10 +395,11 @@ static u8 ChooseMoveOrAction_Doubles(void)
         }
         else
         {
+            // The damage matrix was already simulated by BattleAI_SetupAIData.
             if (gBattleTypeFlags & BATTLE_TYPE_PALACE)
-                BattleAI_SetupAIData(gBattleStruct->palaceFlags >> 4);
+                BattleAI_ResetScores(gBattleStruct->palaceFlags >> 4);
             else
-                BattleAI_SetupAIData(0xF);
+                BattleAI_ResetScores(0xF);
             
             gBattlerTarget = i;
             GetAiLogicData(sBattler_AI, gBattlerTarget);
@@ -6,6 +6,7 @@
 #include "battle_controllers.h"
 #include "battle_setup.h"
 #include "battle_util.h"
+#include "malloc.h"
 #include "pokemon.h"
 #include "random.h"
 #include "util.h"
@@ -780,7 +781,7 @@ static u32 GetBestMonBatonPass(struct Pokemon *party, int firstId, int lastId, u
     return PARTY_SIZE;
 }
 
-static u32 GetBestMonDefensive(struct Pokemon *party, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
+static u32 GetBestMonDefensive(const struct BattlePokemon *partyViews, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
 {
     int i, bits = 0;
     u16 chosenSpecies;
@@ -795,7 +796,7 @@ static u32 GetBestMonDefensive(struct Pokemon *party, int firstId, int lastId, u
         {
             if (!(gBitTable[i] & invalidMons) && !(gBitTable[i] & bits))
             {
-                u16 species = GetMonData(&party[i], MON_DATA_SPECIES);
+                u16 species = partyViews[i].species;
                 u32 typeDmg = UQ_4_12(1.0);
 
                 u8 defType1 = gBaseStats[species].type1;
@@ -837,7 +838,7 @@ static u32 GetBestMonDefensive(struct Pokemon *party, int firstId, int lastId, u
         {
             for (i = 0; i < MAX_MON_MOVES; i++)
             {
-                u32 move = GetMonData(&party[bestMonId], MON_DATA_MOVE1 + i);
+                u32 move = partyViews[bestMonId].moves[i];
                 if (move != MOVE_NONE && AI_GetTypeEffectiveness(move, chosenSpecies, opposingBattler) >= UQ_4_12(2.0))
                     break;
             }
@@ -856,7 +857,7 @@ static u32 GetBestMonDefensive(struct Pokemon *party, int firstId, int lastId, u
     return PARTY_SIZE;
 }
 
-static u32 GetBestMonOffensive(struct Pokemon *party, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
+static u32 GetBestMonOffensive(const struct BattlePokemon *partyViews, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
 {
     int i, bits = 0;
 
@@ -869,7 +870,7 @@ static u32 GetBestMonOffensive(struct Pokemon *party, int firstId, int lastId, u
         {
             if (!(gBitTable[i] & invalidMons) && !(gBitTable[i] & bits))
             {
-                u16 species = GetMonData(&party[i], MON_DATA_SPECIES);
+                u16 species = partyViews[i].species;
                 u32 typeDmg = UQ_4_12(1.0);
 
                 u8 atkType1 = gBaseStats[species].type1;
@@ -899,7 +900,7 @@ static u32 GetBestMonOffensive(struct Pokemon *party, int firstId, int lastId, u
         {
             for (i = 0; i < MAX_MON_MOVES; i++)
             {
-                u32 move = GetMonData(&party[bestMonId], MON_DATA_MOVE1 + i);
+                u32 move = partyViews[bestMonId].moves[i];
                 if (move != MOVE_NONE && AI_GetTypeEffectiveness(move, gActiveBattler, opposingBattler) >= UQ_4_12(2.0))
                     break;
             }
@@ -918,7 +919,7 @@ static u32 GetBestMonOffensive(struct Pokemon *party, int firstId, int lastId, u
     return PARTY_SIZE;
 }
 
-static u32 GetBestMonDmg(struct Pokemon *party, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
+static u32 GetBestMonDmg(const struct BattlePokemon *partyViews, int firstId, int lastId, u8 invalidMons, u32 opposingBattler)
 {
     int i, j;
     int bestDmg = 0;
@@ -933,10 +934,10 @@ static u32 GetBestMonDmg(struct Pokemon *party, int firstId, int lastId, u8 inva
 
         for (j = 0; j < MAX_MON_MOVES; j++)
         {
-            u32 move = GetMonData(&party[i], MON_DATA_MOVE1 + j);
+            u32 move = partyViews[i].moves[j];
             if (move != MOVE_NONE && gBattleMoves[move].power != 0)
             {
-                s32 dmg = AI_CalcPartyMonDamage(move, gActiveBattler, opposingBattler, &party[i]);
+                s32 dmg = AI_CalcBattlerViewDamage(move, gActiveBattler, opposingBattler, &partyViews[i]);
                 if (bestDmg < dmg)
                 {
                     bestDmg = dmg;
@@ -958,6 +959,7 @@ u8 GetMostSuitableMonToSwitchInto(void)
     s32 firstId = 0;
     s32 lastId = 0; // + 1
     struct Pokemon *party;
+    struct BattlePokemon *partyViews;
     s32 i, j, aliveCount = 0;
     u8 invalidMons = 0;
 
@@ -1011,19 +1013,23 @@ u8 GetMostSuitableMonToSwitchInto(void)
     if (bestMonId != PARTY_SIZE)
         return bestMonId;
 
-    bestMonId = GetBestMonDefensive(party, firstId, lastId, invalidMons, opposingBattler);
-    if (bestMonId != PARTY_SIZE)
-        return bestMonId;
+    // Convert every candidate to battle form once, the checks below only read these views.
+    partyViews = Alloc(sizeof(struct BattlePokemon) * PARTY_SIZE);
+    for (i = firstId; i < lastId; i++)
+    {
+        if (!(gBitTable[i] & invalidMons))
+            PokemonToBattleMon(&party[i], &partyViews[i]);
+    }
 
-    bestMonId = GetBestMonOffensive(party, firstId, lastId, invalidMons, opposingBattler);
-    if (bestMonId != PARTY_SIZE)
-        return bestMonId;
+    bestMonId = GetBestMonDefensive(partyViews, firstId, lastId, invalidMons, opposingBattler);
+    if (bestMonId == PARTY_SIZE)
+        bestMonId = GetBestMonOffensive(partyViews, firstId, lastId, invalidMons, opposingBattler);
+    if (bestMonId == PARTY_SIZE)
+        bestMonId = GetBestMonDmg(partyViews, firstId, lastId, invalidMons, opposingBattler);
 
-    bestMonId = GetBestMonDmg(party, firstId, lastId, invalidMons, opposingBattler);
-    if (bestMonId != PARTY_SIZE)
-        return bestMonId;
+    Free(partyViews);
 
-    return PARTY_SIZE;
+    return bestMonId;
 }
 
 static u8 GetAI_ItemType(u16 itemId, const u8 *itemEffect)
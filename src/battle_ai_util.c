@@ -1,5 +1,4 @@
 #include "global.h"
-#include "malloc.h"
 #include "battle.h"
 #include "battle_anim.h"
 #include "battle_ai_util.h"
@@ -563,6 +562,7 @@ void SetBattlerData(u8 battlerId)
         // The ability is unknown.
         else
             gBattleMons[battlerId].ability = ABILITY_NONE;
+        InvalidateBattlerAbilityCache();
 
         if (BATTLE_HISTORY->itemEffects[battlerId] == 0)
             gBattleMons[battlerId].item = 0;
@@ -586,6 +586,7 @@ void RestoreBattlerData(u8 battlerId)
         u32 i;
 
         gBattleMons[battlerId].ability = AI_THINKING_STRUCT->saved[battlerId].ability;
+        InvalidateBattlerAbilityCache();
         gBattleMons[battlerId].item = AI_THINKING_STRUCT->saved[battlerId].heldItem;
         gBattleMons[battlerId].species = AI_THINKING_STRUCT->saved[battlerId].species;
         for (i = 0; i < 4; i++)
@@ -740,12 +741,17 @@ s32 AI_CalcDamage(u16 move, u8 battlerAtk, u8 battlerDef)
 
     critChance = GetInverseCritChance(battlerAtk, battlerDef, move);
     normalDmg = CalculateMoveDamage(move, battlerAtk, battlerDef, moveType, 0, FALSE, FALSE, FALSE);
-    critDmg = CalculateMoveDamage(move, battlerAtk, battlerDef, moveType, 0, TRUE, FALSE, FALSE);
 
+    // Only pay for the crit calc when the move can actually crit.
     if(critChance == -1)
+    {
         dmg = normalDmg;
+    }
     else
+    {
+        critDmg = CalculateMoveDamage(move, battlerAtk, battlerDef, moveType, 0, TRUE, FALSE, FALSE);
         dmg = (critDmg + normalDmg * (critChance - 1)) / critChance;
+    }
 
     // Handle dynamic move damage
     switch (gBattleMoves[move].effect)
@@ -3260,24 +3266,31 @@ bool32 ShouldUseWishAromatherapy(u8 battlerAtk, u8 battlerDef, u16 move)
 }
 
 // party logic
-s32 AI_CalcPartyMonDamage(u16 move, u8 battlerAtk, u8 battlerDef, struct Pokemon *mon)
+// Damage dealt by a battler view built with PokemonToBattleMon, as if it were in battlerAtk's slot.
+// The damage calc reads the attacker from gBattleMons through every ability, item and stat
+// helper, so the view is put in battlerAtk's slot for the duration of the calc. Only that
+// slot is saved, on the stack. Callers convert each party mon once and reuse the view for
+// every move.
+s32 AI_CalcBattlerViewDamage(u16 move, u8 battlerAtk, u8 battlerDef, const struct BattlePokemon *view)
 {
     s32 dmg;
-    u32 i;
-    struct BattlePokemon *battleMons = Alloc(sizeof(struct BattlePokemon) * MAX_BATTLERS_COUNT);
+    struct BattlePokemon savedMon = gBattleMons[battlerAtk];
 
-    for (i = 0; i < MAX_BATTLERS_COUNT; i++)
-        battleMons[i] = gBattleMons[i];
-
-    PokemonToBattleMon(mon, &gBattleMons[battlerAtk]);
+    gBattleMons[battlerAtk] = *view;
+    InvalidateBattlerAbilityCache();
     dmg = AI_CalcDamage(move, battlerAtk, battlerDef);
+    gBattleMons[battlerAtk] = savedMon;
+    InvalidateBattlerAbilityCache();
 
-    for (i = 0; i < MAX_BATTLERS_COUNT; i++)
-        gBattleMons[i] = battleMons[i];
+    return dmg;
+}
 
-    Free(battleMons);
+s32 AI_CalcPartyMonDamage(u16 move, u8 battlerAtk, u8 battlerDef, struct Pokemon *mon)
+{
+    struct BattlePokemon view;
 
-    return dmg;
+    PokemonToBattleMon(mon, &view);
+    return AI_CalcBattlerViewDamage(move, battlerAtk, battlerDef, &view);
 }
 
 s32 CountUsablePartyMons(u8 battlerId)
@@ -22,6 +22,30 @@
 
 #define ANIM_SPRITE_INDEX_COUNT 8
 
+// Sprite sheets loaded by loadspritegfx stay in VRAM after their last unload, so a move used
+// again (or another move sharing the sheet) doesn't have to decompress it again. Idle sheets
+// are evicted least recently used first, once they hold more than ANIM_GFX_CACHE_MAX_IDLE_TILES
+// or when a new sheet doesn't fit. Palettes are still freed on unload, as tasks recolor them.
+#define ANIM_GFX_CACHE_COUNT 8
+#define ANIM_GFX_CACHE_MAX_IDLE_TILES 64
+
+struct AnimGfxCacheEntry
+{
+    u16 index; // into gBattleAnimPicTable, 0xFFFF if unused
+    u16 lastUsed;
+    u8 refCount;
+};
+
+struct AnimGfxCache
+{
+    struct AnimGfxCacheEntry entries[ANIM_GFX_CACHE_COUNT];
+    u16 clock;
+#ifdef ANIM_GFX_CACHE_STATS
+    u32 hits;
+    u32 misses;
+#endif
+};
+
 extern struct MusicPlayerInfo gMPlayInfo_BGM;
 extern struct MusicPlayerInfo gMPlayInfo_SE1;
 extern struct MusicPlayerInfo gMPlayInfo_SE2;
@@ -80,6 +104,9 @@ static void ScriptCmd_doublebattle_2E(void);
 static void ScriptCmd_stopsound(void);
 
 static void RunAnimScriptCommand(void);
+static void ResetAnimGfxCache(void);
+static void LoadAnimSpriteGfx(u16 index);
+static void FreeAnimSpriteGfx(u16 index);
 static void task_pA_ma0A_obj_to_bg_pal(u8 taskId);
 static void sub_80A46A0(void);
 static void sub_80A4980(u8 taskId);
@@ -102,6 +129,7 @@ EWRAM_DATA struct DisableStruct *gAnimDisableStructPtr = NULL;
 EWRAM_DATA s32 gAnimMoveDmg = 0;
 EWRAM_DATA u16 gAnimMovePower = 0;
 EWRAM_DATA static u16 sAnimSpriteIndexArray[ANIM_SPRITE_INDEX_COUNT] = {0};
+EWRAM_DATA static struct AnimGfxCache sAnimGfxCache = {0};
 EWRAM_DATA u8 gAnimFriendship = 0;
 EWRAM_DATA u16 gWeatherMoveAnim = 0;
 EWRAM_DATA s16 gBattleAnimArgs[ANIM_ARGS_COUNT] = {0};
@@ -2176,6 +2204,9 @@ void ClearBattleAnimationVars(void)
     for (i = 0; i < ANIM_SPRITE_INDEX_COUNT; i++)
         sAnimSpriteIndexArray[i] = 0xFFFF;
 
+    // Nothing from a previous battle is left in VRAM.
+    ResetAnimGfxCache();
+
     // Clear anim args.
     for (i = 0; i < ANIM_ARGS_COUNT; i++)
         gBattleAnimArgs[i] = 0;
@@ -2354,14 +2385,152 @@ static void RunAnimScriptCommand(void)
     } while (gAnimFramesToWait == 0 && gAnimScriptActive);
 }
 
+static void ResetAnimGfxCache(void)
+{
+    s32 i;
+
+    for (i = 0; i < ANIM_GFX_CACHE_COUNT; i++)
+    {
+        sAnimGfxCache.entries[i].index = 0xFFFF;
+        sAnimGfxCache.entries[i].refCount = 0;
+    }
+    sAnimGfxCache.clock = 0;
+
+#ifdef ANIM_GFX_CACHE_STATS
+    if (sAnimGfxCache.hits != 0 || sAnimGfxCache.misses != 0)
+        AGBPrintf("ANIMGFX hits=%u misses=%u\n", sAnimGfxCache.hits, sAnimGfxCache.misses);
+    sAnimGfxCache.hits = 0;
+    sAnimGfxCache.misses = 0;
+#endif
+}
+
+static struct AnimGfxCacheEntry *FindAnimGfxCacheEntry(u16 index)
+{
+    s32 i;
+
+    for (i = 0; i < ANIM_GFX_CACHE_COUNT; i++)
+    {
+        if (sAnimGfxCache.entries[i].index == index)
+            return &sAnimGfxCache.entries[i];
+    }
+    return NULL;
+}
+
+static void EvictAnimGfxCacheEntry(struct AnimGfxCacheEntry *entry)
+{
+    FreeSpriteTilesByTag(gBattleAnimPicTable[entry->index].tag);
+    entry->index = 0xFFFF;
+    entry->refCount = 0;
+}
+
+// Returns the least recently used sheet that no animation is using, or NULL
+static struct AnimGfxCacheEntry *GetOldestIdleAnimGfx(void)
+{
+    s32 i;
+    struct AnimGfxCacheEntry *oldest = NULL;
+
+    for (i = 0; i < ANIM_GFX_CACHE_COUNT; i++)
+    {
+        struct AnimGfxCacheEntry *entry = &sAnimGfxCache.entries[i];
+
+        if (entry->index == 0xFFFF || entry->refCount != 0)
+            continue;
+        if (oldest == NULL || (u16)(sAnimGfxCache.clock - entry->lastUsed) > (u16)(sAnimGfxCache.clock - oldest->lastUsed))
+            oldest = entry;
+    }
+    return oldest;
+}
+
+static void TrimIdleAnimGfx(void)
+{
+    s32 i;
+    u32 idleTiles = 0;
+    struct AnimGfxCacheEntry *oldest;
+
+    for (i = 0; i < ANIM_GFX_CACHE_COUNT; i++)
+    {
+        if (sAnimGfxCache.entries[i].index != 0xFFFF && sAnimGfxCache.entries[i].refCount == 0)
+            idleTiles += gBattleAnimPicTable[sAnimGfxCache.entries[i].index].size / TILE_SIZE_4BPP;
+    }
+
+    while (idleTiles > ANIM_GFX_CACHE_MAX_IDLE_TILES && (oldest = GetOldestIdleAnimGfx()) != NULL)
+    {
+        idleTiles -= gBattleAnimPicTable[oldest->index].size / TILE_SIZE_4BPP;
+        EvictAnimGfxCacheEntry(oldest);
+    }
+}
+
+static void LoadAnimSpriteGfx(u16 index)
+{
+    u16 tag = gBattleAnimPicTable[index].tag;
+    struct AnimGfxCacheEntry *entry = FindAnimGfxCacheEntry(index);
+    struct AnimGfxCacheEntry *oldest;
+
+    // The sheet may have been freed behind the cache's back, e.g. when the battle screen is reloaded
+    if (entry != NULL && GetSpriteTileStartByTag(tag) == 0xFFFF)
+    {
+        entry->index = 0xFFFF;
+        entry->refCount = 0;
+        entry = NULL;
+    }
+
+#ifdef ANIM_GFX_CACHE_STATS
+    if (entry != NULL)
+        sAnimGfxCache.hits++;
+    else
+        sAnimGfxCache.misses++;
+#endif
+
+    if (entry == NULL)
+    {
+        LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[index]);
+
+        // Out of sprite tiles, make room by dropping idle sheets until it fits
+        while (GetSpriteTileStartByTag(tag) == 0xFFFF && (oldest = GetOldestIdleAnimGfx()) != NULL)
+        {
+            EvictAnimGfxCacheEntry(oldest);
+            LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[index]);
+        }
+
+        entry = FindAnimGfxCacheEntry(0xFFFF);
+        if (entry == NULL && (entry = GetOldestIdleAnimGfx()) != NULL)
+            EvictAnimGfxCacheEntry(entry);
+        if (entry != NULL)
+            entry->index = index;
+    }
+
+    // Entries that couldn't be cached are freed on unload as before
+    if (entry != NULL)
+        entry->refCount++;
+    LoadCompressedSpritePaletteUsingHeap(&gBattleAnimPaletteTable[index]);
+}
+
+static void FreeAnimSpriteGfx(u16 index)
+{
+    struct AnimGfxCacheEntry *entry = FindAnimGfxCacheEntry(index);
+
+    if (entry != NULL && entry->refCount != 0)
+    {
+        if (--entry->refCount == 0)
+        {
+            entry->lastUsed = sAnimGfxCache.clock++;
+            TrimIdleAnimGfx();
+        }
+    }
+    else
+    {
+        FreeSpriteTilesByTag(gBattleAnimPicTable[index].tag);
+    }
+    FreeSpritePaletteByTag(gBattleAnimPicTable[index].tag);
+}
+
 static void ScriptCmd_loadspritegfx(void)
 {
     u16 index;
 
     sBattleAnimScriptPtr++;
     index = T1_READ_16(sBattleAnimScriptPtr);
-    LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)]);
-    LoadCompressedSpritePaletteUsingHeap(&gBattleAnimPaletteTable[GET_TRUE_SPRITE_INDEX(index)]);
+    LoadAnimSpriteGfx(GET_TRUE_SPRITE_INDEX(index));
     sBattleAnimScriptPtr += 2;
     AddSpriteIndex(GET_TRUE_SPRITE_INDEX(index));
     gAnimFramesToWait = 1;
@@ -2374,8 +2543,7 @@ static void ScriptCmd_unloadspritegfx(void)
 
     sBattleAnimScriptPtr++;
     index = T1_READ_16(sBattleAnimScriptPtr);
-    FreeSpriteTilesByTag(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
-    FreeSpritePaletteByTag(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
+    FreeAnimSpriteGfx(GET_TRUE_SPRITE_INDEX(index));
     sBattleAnimScriptPtr += 2;
     ClearSpriteIndex(GET_TRUE_SPRITE_INDEX(index));
 }
@@ -2532,8 +2700,7 @@ static void ScriptCmd_end(void)
     {
         if (sAnimSpriteIndexArray[i] != 0xFFFF)
         {
-            FreeSpriteTilesByTag(gBattleAnimPicTable[sAnimSpriteIndexArray[i]].tag);
-            FreeSpritePaletteByTag(gBattleAnimPicTable[sAnimSpriteIndexArray[i]].tag);
+            FreeAnimSpriteGfx(sAnimSpriteIndexArray[i]);
             sAnimSpriteIndexArray[i] = 0xFFFF; // set terminator.
         }
     }
@@ -2,6 +2,7 @@
 #include "battle.h"
 #include "battle_anim.h"
 #include "battle_message.h"
+#include "battle_util.h"
 #include "main.h"
 #include "menu.h"
 #include "menu_helpers.h"
@@ -1458,6 +1459,7 @@ static void UpdateBattlerValue(struct BattleDebugMenu *data)
         break;
     }
     data->battlerWasChanged[data->battlerId] = TRUE;
+    InvalidateBattlerAbilityCache();
 }
 
 static u32 CharDigitsToValue(u8 *charDigits, u8 maxDigits)
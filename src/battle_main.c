@@ -3065,6 +3065,7 @@ static void BattleStartClearSetData(void)
     }
 
     gSwapDamageCategory = FALSE; // Photon Geyser, Shell Side Arm, Light That Burns the Sky
+    InvalidateBattlerAbilityCache();
 }
 
 void SwitchInClearSetData(void)
@@ -3180,6 +3181,7 @@ void SwitchInClearSetData(void)
     ClearBattlerMoveHistory(gActiveBattler);
     ClearBattlerAbilityHistory(gActiveBattler);
     ClearBattlerItemEffectHistory(gActiveBattler);
+    InvalidateBattlerAbilityCache();
 }
 
 void FaintClearSetData(void)
@@ -3192,6 +3194,7 @@ void FaintClearSetData(void)
     gBattleMons[gActiveBattler].status2 = 0;
     gStatuses3[gActiveBattler] = 0;
     gStatuses4[gActiveBattler] = 0;
+    InvalidateBattlerAbilityCache();
 
     for (i = 0; i < gBattlersCount; i++)
     {
@@ -3333,6 +3336,7 @@ static void DoBattleIntro(void)
                 gBattleMons[gActiveBattler].type2 = gBaseStats[gBattleMons[gActiveBattler].species].type2;
                 gBattleMons[gActiveBattler].type3 = TYPE_MYSTERY;
                 gBattleMons[gActiveBattler].ability = GetAbilityBySpecies(gBattleMons[gActiveBattler].species, gBattleMons[gActiveBattler].abilityNum);
+                InvalidateBattlerAbilityCache();
                 gBattleStruct->hpOnSwitchout[GetBattlerSide(gActiveBattler)] = gBattleMons[gActiveBattler].hp;
                 gBattleMons[gActiveBattler].status2 = 0;
                 for (i = 0; i < NUM_BATTLE_STATS; i++)
@@ -5170,7 +5174,7 @@ static void HandleEndTurn_FinishBattle(void)
     else
     {
         if (gBattleControllerExecFlags == 0)
-            gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+            RunBattleScriptCommandBatch();
     }
 }
 
@@ -5280,14 +5284,14 @@ void RunBattleScriptCommands_PopCallbacksStack(void)
     else
     {
         if (gBattleControllerExecFlags == 0)
-            gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+            RunBattleScriptCommandBatch();
     }
 }
 
 void RunBattleScriptCommands(void)
 {
     if (gBattleControllerExecFlags == 0)
-        gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+        RunBattleScriptCommandBatch();
 }
 
 void SetTypeBeforeUsingMove(u16 move, u8 battlerAtk)
@@ -2,6 +2,7 @@
 #include "battle_pyramid.h"
 #include "battle_pyramid_bag.h"
 #include "event_data.h"
+#include "event_object_movement.h"
 #include "battle.h"
 #include "battle_setup.h"
 #include "battle_tower.h"
@@ -1020,6 +1021,7 @@ static void HidePyramidItem(void)
             // it moves them far off the map bounds.
             events[i].x = 0x7FFF;
             events[i].y = 0x7FFF;
+            InvalidateObjectEventSpawnIndex();
             break;
         }
         i++;
@@ -832,6 +832,64 @@ void (* const gBattleScriptingCommandsTable[])(void) =
     Cmd_metalburstdamagecalculator,              //0xFF
 };
 
+// Most battle script commands are bookkeeping and finish in a single call, so up to this many
+// are run back-to-back in a frame. The batch ends early as soon as a command hands work to the
+// controllers, stays on its own instruction to wait, ends the script or is listed below.
+#define BATTLE_SCRIPT_COMMANDS_PER_FRAME 64
+
+// Commands that drive windows, palettes or input directly rather than through the controllers.
+static void (* const sBlockingBattleScriptCommands[])(void) =
+{
+    Cmd_waitanimation,
+    Cmd_waitmessage,
+    Cmd_getexp,
+    Cmd_pause,
+    Cmd_waitstate,
+    Cmd_trainerslidein,
+    Cmd_handlelearnnewmove,
+    Cmd_yesnoboxlearnmove,
+    Cmd_yesnoboxstoplearningmove,
+    Cmd_yesnobox,
+    Cmd_drawlvlupbox,
+    Cmd_displaydexinfo,
+    Cmd_trygivecaughtmonnick,
+};
+
+static bool32 IsBattleScriptCommandBlocking(void (*command)(void))
+{
+    u32 i;
+
+    for (i = 0; i < ARRAY_COUNT(sBlockingBattleScriptCommands); i++)
+    {
+        if (sBlockingBattleScriptCommands[i] == command)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+void RunBattleScriptCommandBatch(void)
+{
+    u32 i;
+    const u8 *instr;
+    void (*command)(void);
+    void (*mainFunc)(void) = gBattleMainFunc;
+    u8 actionFuncId = gCurrentActionFuncId;
+
+    for (i = 0; i < BATTLE_SCRIPT_COMMANDS_PER_FRAME; i++)
+    {
+        instr = gBattlescriptCurrInstr;
+        command = gBattleScriptingCommandsTable[instr[0]];
+        command();
+
+        if (gBattleControllerExecFlags != 0
+         || gBattlescriptCurrInstr == instr
+         || gBattleMainFunc != mainFunc
+         || gCurrentActionFuncId != actionFuncId
+         || IsBattleScriptCommandBlocking(command))
+            break;
+    }
+}
+
 const struct StatFractions gAccuracyStageRatios[] =
 {
     { 33, 100}, // -6
@@ -4128,6 +4186,7 @@ static void Cmd_getexp(void)
             // not sure why gf clears the item and ability here
             gBattleMons[gBattlerFainted].item = 0;
             gBattleMons[gBattlerFainted].ability = 0;
+            InvalidateBattlerAbilityCache();
             gBattlescriptCurrInstr += 2;
         }
         break;
@@ -5719,6 +5778,7 @@ static void Cmd_switchindataupdate(void)
     gBattleMons[gActiveBattler].type2 = gBaseStats[gBattleMons[gActiveBattler].species].type2;
     gBattleMons[gActiveBattler].type3 = TYPE_MYSTERY;
     gBattleMons[gActiveBattler].ability = GetAbilityBySpecies(gBattleMons[gActiveBattler].species, gBattleMons[gActiveBattler].abilityNum);
+    InvalidateBattlerAbilityCache();
 
     // check knocked off item
     i = GetBattlerSide(gActiveBattler);
@@ -7675,6 +7735,7 @@ static void RecalcBattlerStats(u32 battler, struct Pokemon *mon)
     gBattleMons[battler].spAttack = GetMonData(mon, MON_DATA_SPATK);
     gBattleMons[battler].spDefense = GetMonData(mon, MON_DATA_SPDEF);
     gBattleMons[battler].ability = GetMonAbility(mon);
+    InvalidateBattlerAbilityCache();
     gBattleMons[battler].type1 = gBaseStats[gBattleMons[battler].species].type1;
     gBattleMons[battler].type2 = gBaseStats[gBattleMons[battler].species].type2;
 }
@@ -7842,6 +7903,7 @@ static void Cmd_various(void)
         return;
     case VARIOUS_TRACE_ABILITY:
         gBattleMons[gActiveBattler].ability = gBattleStruct->tracedAbility[gActiveBattler];
+        InvalidateBattlerAbilityCache();
         RecordAbilityBattle(gActiveBattler, gBattleMons[gActiveBattler].ability);
         break;
     case VARIOUS_TRY_ILLUSION_OFF:
@@ -8314,6 +8376,7 @@ static void Cmd_various(void)
                 gSpecialStatuses[gBattlerTarget].neutralizingGasRemoved = TRUE;
                 
             gBattleMons[gBattlerTarget].ability = ABILITY_SIMPLE;
+            InvalidateBattlerAbilityCache();
             gBattlescriptCurrInstr += 7;
         }
         return;
@@ -8332,6 +8395,7 @@ static void Cmd_various(void)
         else
         {
             gBattleMons[gBattlerTarget].ability = gBattleMons[gBattlerAttacker].ability;
+            InvalidateBattlerAbilityCache();
             gBattlescriptCurrInstr += 7;
         }
         return;
@@ -11061,6 +11125,7 @@ static void Cmd_transformdataexecution(void)
 
         for (i = 0; i < offsetof(struct BattlePokemon, pp); i++)
             battleMonAttacker[i] = battleMonTarget[i];
+        InvalidateBattlerAbilityCache();
 
         for (i = 0; i < MAX_MON_MOVES; i++)
         {
@@ -12555,6 +12620,7 @@ static void Cmd_trycopyability(void) // role play
     else
     {
         gBattleMons[gBattlerAttacker].ability = defAbility;
+        InvalidateBattlerAbilityCache();
         gLastUsedAbility = defAbility;
         gBattlescriptCurrInstr += 5;
     }
@@ -12624,6 +12690,7 @@ static void Cmd_setgastroacid(void)
             gSpecialStatuses[gBattlerTarget].neutralizingGasRemoved = TRUE;
         
         gStatuses3[gBattlerTarget] |= STATUS3_GASTRO_ACID;
+        InvalidateBattlerAbilityCache();
         gBattlescriptCurrInstr += 5;
     }
 }
@@ -12721,6 +12788,7 @@ static void Cmd_tryswapabilities(void) // skill swap
         u16 abilityAtk = gBattleMons[gBattlerAttacker].ability;
         gBattleMons[gBattlerAttacker].ability = gBattleMons[gBattlerTarget].ability;
         gBattleMons[gBattlerTarget].ability = abilityAtk;
+        InvalidateBattlerAbilityCache();
 
         gBattlescriptCurrInstr += 5;
     }
@@ -12906,6 +12974,7 @@ static void Cmd_switchoutabilities(void)
     if (gBattleMons[gActiveBattler].ability == ABILITY_NEUTRALIZING_GAS)
     {
         gBattleMons[gActiveBattler].ability = ABILITY_NONE;
+        InvalidateBattlerAbilityCache();
         BattleScriptPush(gBattlescriptCurrInstr);
         gBattlescriptCurrInstr = BattleScript_NeutralizingGasExits;
     }
@@ -14125,6 +14194,7 @@ static void Cmd_tryworryseed(void)
     else
     {
         gBattleMons[gBattlerTarget].ability = ABILITY_INSOMNIA;
+        InvalidateBattlerAbilityCache();
         gBattlescriptCurrInstr += 5;
     }
 }
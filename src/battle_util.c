@@ -5069,6 +5069,7 @@ u8 AbilityBattleEffects(u8 caseID, u8 battler, u16 ability, u8 special, u16 move
                     break;
                 default:
                     gLastUsedAbility = gBattleMons[gBattlerAttacker].ability = ABILITY_MUMMY;
+                    InvalidateBattlerAbilityCache();
                     BattleScriptPushCursor();
                     gBattlescriptCurrInstr = BattleScript_MummyActivates;
                     effect++;
@@ -5102,6 +5103,7 @@ u8 AbilityBattleEffects(u8 caseID, u8 battler, u16 ability, u8 special, u16 move
                     gLastUsedAbility = gBattleMons[gBattlerAttacker].ability;
                     gBattleMons[gBattlerAttacker].ability = gBattleMons[gBattlerTarget].ability;
                     gBattleMons[gBattlerTarget].ability = gLastUsedAbility;
+                    InvalidateBattlerAbilityCache();
                     RecordAbilityBattle(gBattlerAttacker, gBattleMons[gBattlerAttacker].ability);
                     RecordAbilityBattle(gBattlerTarget, gBattleMons[gBattlerTarget].ability);
                     BattleScriptPushCursor();
@@ -5764,7 +5766,71 @@ bool32 IsNeutralizingGasBannedAbility(u32 ability)
     }
 }
 
+// Gastro Acid-resolved abilities of every battler and the battlers whose Neutralizing Gas is
+// not suppressed. Invalidated whenever an ability or Gastro Acid changes; whether a gas holder
+// is still alive is checked on use, so faints and switch-outs never leave the flag stale.
+struct BattlerAbilityCache
+{
+    u16 abilities[MAX_BATTLERS_COUNT];
+    u8 neutralizingGasHolders;
+    bool8 valid;
+};
+
+static EWRAM_DATA struct BattlerAbilityCache sBattlerAbilityCache = {0};
+
+void InvalidateBattlerAbilityCache(void)
+{
+    sBattlerAbilityCache.valid = FALSE;
+}
+
+static void UpdateBattlerAbilityCache(void)
+{
+    u32 i;
+
+    sBattlerAbilityCache.neutralizingGasHolders = 0;
+    for (i = 0; i < MAX_BATTLERS_COUNT; i++)
+    {
+        if (gStatuses3[i] & STATUS3_GASTRO_ACID)
+            sBattlerAbilityCache.abilities[i] = ABILITY_NONE;
+        else
+            sBattlerAbilityCache.abilities[i] = gBattleMons[i].ability;
+
+        if (i < gBattlersCount && sBattlerAbilityCache.abilities[i] == ABILITY_NEUTRALIZING_GAS)
+            sBattlerAbilityCache.neutralizingGasHolders |= gBitTable[i];
+    }
+    sBattlerAbilityCache.valid = TRUE;
+}
+
 bool32 IsNeutralizingGasOnField(void)
+{
+    u32 i, holders;
+
+    if (!sBattlerAbilityCache.valid)
+        UpdateBattlerAbilityCache();
+
+    for (i = 0, holders = sBattlerAbilityCache.neutralizingGasHolders; holders != 0; i++, holders >>= 1)
+    {
+        if ((holders & 1) && IsBattlerAlive(i))
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+static bool32 IsMoldBreakerIgnoringAbility(u32 ability)
+{
+    return sAbilitiesAffectedByMoldBreaker[ability]
+        && gBattlerByTurnOrder[gCurrentTurnActionNumber] == gBattlerAttacker
+        && gActionsByTurnOrder[gBattlerByTurnOrder[gBattlerAttacker]] == B_ACTION_USE_MOVE
+        && gCurrentTurnActionNumber < gBattlersCount
+        && (sBattlerAbilityCache.abilities[gBattlerAttacker] == ABILITY_MOLD_BREAKER
+            || sBattlerAbilityCache.abilities[gBattlerAttacker] == ABILITY_TERAVOLT
+            || sBattlerAbilityCache.abilities[gBattlerAttacker] == ABILITY_TURBOBLAZE
+            || gBattleMoves[gCurrentMove].flags & FLAG_TARGET_ABILITY_IGNORED);
+}
+
+#if B_ABILITY_CACHE_DEBUG == TRUE
+static bool32 IsNeutralizingGasOnField_Slow(void)
 {
     u32 i;
 
@@ -5777,14 +5843,14 @@ bool32 IsNeutralizingGasOnField(void)
     return FALSE;
 }
 
-u32 GetBattlerAbility(u8 battlerId)
+static u32 GetBattlerAbility_Slow(u8 battlerId)
 {
     if (gStatuses3[battlerId] & STATUS3_GASTRO_ACID)
         return ABILITY_NONE;
-    
-    if (IsNeutralizingGasOnField() && !IsNeutralizingGasBannedAbility(gBattleMons[battlerId].ability))
+
+    if (IsNeutralizingGasOnField_Slow() && !IsNeutralizingGasBannedAbility(gBattleMons[battlerId].ability))
         return ABILITY_NONE;
-    
+
     if ((((gBattleMons[gBattlerAttacker].ability == ABILITY_MOLD_BREAKER
             || gBattleMons[gBattlerAttacker].ability == ABILITY_TERAVOLT
             || gBattleMons[gBattlerAttacker].ability == ABILITY_TURBOBLAZE)
@@ -5795,9 +5861,45 @@ u32 GetBattlerAbility(u8 battlerId)
             && gActionsByTurnOrder[gBattlerByTurnOrder[gBattlerAttacker]] == B_ACTION_USE_MOVE
             && gCurrentTurnActionNumber < gBattlersCount)
         return ABILITY_NONE;
-    
+
     return gBattleMons[battlerId].ability;
 }
+#endif
+
+static u32 GetBattlerAbility_Cached(u8 battlerId)
+{
+    u32 ability;
+
+    if (!sBattlerAbilityCache.valid)
+        UpdateBattlerAbilityCache();
+
+    ability = sBattlerAbilityCache.abilities[battlerId];
+    if (ability == ABILITY_NONE)
+        return ABILITY_NONE;
+
+    if (sBattlerAbilityCache.neutralizingGasHolders != 0
+     && !IsNeutralizingGasBannedAbility(ability)
+     && IsNeutralizingGasOnField())
+        return ABILITY_NONE;
+
+    if (IsMoldBreakerIgnoringAbility(ability))
+        return ABILITY_NONE;
+
+    return ability;
+}
+
+u32 GetBattlerAbility(u8 battlerId)
+{
+#if B_ABILITY_CACHE_DEBUG == TRUE
+    u32 ability = GetBattlerAbility_Cached(battlerId);
+
+    AGB_ASSERT(ability == GetBattlerAbility_Slow(battlerId));
+    AGB_ASSERT(IsNeutralizingGasOnField() == IsNeutralizingGasOnField_Slow());
+    return ability;
+#else
+    return GetBattlerAbility_Cached(battlerId);
+#endif
+}
 
 u32 IsAbilityOnSide(u32 battlerId, u32 ability)
 {
@@ -7348,7 +7450,7 @@ void ClearFuryCutterDestinyBondGrudge(u8 battlerId)
 void HandleAction_RunBattleScript(void) // identical to RunBattleScriptCommands
 {
     if (gBattleControllerExecFlags == 0)
-        gBattleScriptingCommandsTable[*gBattlescriptCurrInstr]();
+        RunBattleScriptCommandBatch();
 }
 
 u32 SetRandomTarget(u32 battlerId)
@@ -9131,14 +9233,82 @@ static void UpdateMoveResultFlags(u16 modifier)
     }
 }
 
+// Combined type chart multiplier of each battler's types against every attacking type.
+// Rows remember the types they were built from, so Soak, Conversion, Forest's Curse,
+// mega evolution and switch-ins are picked up by the next query that sees different types.
+struct TypeEffectivenessRow
+{
+    u16 modifiers[NUMBER_OF_MON_TYPES];
+    u8 types[3];
+    bool8 inverse;
+    bool8 valid;
+};
+
+static EWRAM_DATA struct TypeEffectivenessRow sTypeEffectivenessRows[MAX_BATTLERS_COUNT] = {0};
+
+static const u16 *GetBattlerTypeEffectivenessRow(u8 battlerId)
+{
+    struct TypeEffectivenessRow *row = &sTypeEffectivenessRows[battlerId];
+    u8 type1 = gBattleMons[battlerId].type1;
+    u8 type2 = gBattleMons[battlerId].type2;
+    u8 type3 = gBattleMons[battlerId].type3;
+    bool8 inverse = (B_FLAG_INVERSE_BATTLE != 0 && FlagGet(B_FLAG_INVERSE_BATTLE));
+    u32 atkType;
+
+    if (row->valid && row->types[0] == type1 && row->types[1] == type2 && row->types[2] == type3 && row->inverse == inverse)
+        return row->modifiers;
+
+    for (atkType = 0; atkType < NUMBER_OF_MON_TYPES; atkType++)
+    {
+        u16 modifier = UQ_4_12(1.0);
+
+        MulModifier(&modifier, GetTypeModifier(atkType, type1));
+        if (type2 != type1)
+            MulModifier(&modifier, GetTypeModifier(atkType, type2));
+        if (type3 != TYPE_MYSTERY && type3 != type2 && type3 != type1)
+            MulModifier(&modifier, GetTypeModifier(atkType, type3));
+        row->modifiers[atkType] = modifier;
+    }
+    row->types[0] = type1;
+    row->types[1] = type2;
+    row->types[2] = type3;
+    row->inverse = inverse;
+    row->valid = TRUE;
+    return row->modifiers;
+}
+
+// The per-type adjustments in MulByTypeEffectiveness only matter for immunities, Freeze-Dry,
+// Tar Shot and Strong Winds; everything else is exactly the cached product.
+static bool32 CanUseTypeEffectivenessRow(u16 move, u8 moveType, u8 battlerDef, u16 rowModifier)
+{
+    if (rowModifier == UQ_4_12(0.0))
+        return FALSE;
+    if (gBattleMoves[move].effect == EFFECT_FREEZE_DRY)
+        return FALSE;
+    if (moveType == TYPE_FIRE && gDisableStructs[battlerDef].tarShot)
+        return FALSE;
+    if (gBattleWeather & WEATHER_STRONG_WINDS && IS_BATTLER_OF_TYPE(battlerDef, TYPE_FLYING) && WEATHER_HAS_EFFECT)
+        return FALSE;
+    return TRUE;
+}
+
 static u16 CalcTypeEffectivenessMultiplierInternal(u16 move, u8 moveType, u8 battlerAtk, u8 battlerDef, bool32 recordAbilities, u16 modifier)
 {
-    MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type1, battlerAtk, recordAbilities);
-    if (gBattleMons[battlerDef].type2 != gBattleMons[battlerDef].type1)
-        MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type2, battlerAtk, recordAbilities);
-    if (gBattleMons[battlerDef].type3 != TYPE_MYSTERY && gBattleMons[battlerDef].type3 != gBattleMons[battlerDef].type2
-        && gBattleMons[battlerDef].type3 != gBattleMons[battlerDef].type1)
-        MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type3, battlerAtk, recordAbilities);
+    u16 rowModifier = GetBattlerTypeEffectivenessRow(battlerDef)[moveType];
+
+    if (CanUseTypeEffectivenessRow(move, moveType, battlerDef, rowModifier))
+    {
+        MulModifier(&modifier, rowModifier);
+    }
+    else
+    {
+        MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type1, battlerAtk, recordAbilities);
+        if (gBattleMons[battlerDef].type2 != gBattleMons[battlerDef].type1)
+            MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type2, battlerAtk, recordAbilities);
+        if (gBattleMons[battlerDef].type3 != TYPE_MYSTERY && gBattleMons[battlerDef].type3 != gBattleMons[battlerDef].type2
+            && gBattleMons[battlerDef].type3 != gBattleMons[battlerDef].type1)
+            MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type3, battlerAtk, recordAbilities);
+    }
 
     if (moveType == TYPE_GROUND && !IsBattlerGrounded(battlerDef) && !(gBattleMoves[move].flags & FLAG_DMG_UNGROUNDED_IGNORE_TYPE_IF_FLYING))
     {
@@ -9154,7 +9324,7 @@ static u16 CalcTypeEffectivenessMultiplierInternal(u16 move, u8 moveType, u8 bat
     }
 
     // Thousand Arrows ignores type modifiers for flying mons
-    if (!IsBattlerGrounded(battlerDef) && (gBattleMoves[move].flags & FLAG_DMG_UNGROUNDED_IGNORE_TYPE_IF_FLYING)
+    if ((gBattleMoves[move].flags & FLAG_DMG_UNGROUNDED_IGNORE_TYPE_IF_FLYING) && !IsBattlerGrounded(battlerDef)
         && IS_BATTLER_OF_TYPE(battlerDef, TYPE_FLYING))
     {
         modifier = UQ_4_12(1.0);
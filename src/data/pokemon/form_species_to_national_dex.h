@@ -0,0 +1,379 @@
+    // Megas
+    FORM_SPECIES_TO_NATIONAL(VENUSAUR_MEGA, VENUSAUR),
+    FORM_SPECIES_TO_NATIONAL(CHARIZARD_MEGA_X, CHARIZARD),
+    FORM_SPECIES_TO_NATIONAL(CHARIZARD_MEGA_Y, CHARIZARD),
+    FORM_SPECIES_TO_NATIONAL(BLASTOISE_MEGA, BLASTOISE),
+    FORM_SPECIES_TO_NATIONAL(BEEDRILL_MEGA, BEEDRILL),
+    FORM_SPECIES_TO_NATIONAL(PIDGEOT_MEGA, PIDGEOT),
+    FORM_SPECIES_TO_NATIONAL(ALAKAZAM_MEGA, ALAKAZAM),
+    FORM_SPECIES_TO_NATIONAL(SLOWBRO_MEGA, SLOWBRO),
+    FORM_SPECIES_TO_NATIONAL(GENGAR_MEGA, GENGAR),
+    FORM_SPECIES_TO_NATIONAL(KANGASKHAN_MEGA, KANGASKHAN),
+    FORM_SPECIES_TO_NATIONAL(PINSIR_MEGA, PINSIR),
+    FORM_SPECIES_TO_NATIONAL(GYARADOS_MEGA, GYARADOS),
+    FORM_SPECIES_TO_NATIONAL(AERODACTYL_MEGA, AERODACTYL),
+    FORM_SPECIES_TO_NATIONAL(MEWTWO_MEGA_X, MEWTWO),
+    FORM_SPECIES_TO_NATIONAL(MEWTWO_MEGA_Y, MEWTWO),
+    FORM_SPECIES_TO_NATIONAL(AMPHAROS_MEGA, AMPHAROS),
+    FORM_SPECIES_TO_NATIONAL(STEELIX_MEGA, STEELIX),
+    FORM_SPECIES_TO_NATIONAL(SCIZOR_MEGA, SCIZOR),
+    FORM_SPECIES_TO_NATIONAL(HERACROSS_MEGA, HERACROSS),
+    FORM_SPECIES_TO_NATIONAL(HOUNDOOM_MEGA, HOUNDOOM),
+    FORM_SPECIES_TO_NATIONAL(TYRANITAR_MEGA, TYRANITAR),
+    FORM_SPECIES_TO_NATIONAL(SCEPTILE_MEGA, SCEPTILE),
+    FORM_SPECIES_TO_NATIONAL(BLAZIKEN_MEGA, BLAZIKEN),
+    FORM_SPECIES_TO_NATIONAL(SWAMPERT_MEGA, SWAMPERT),
+    FORM_SPECIES_TO_NATIONAL(GARDEVOIR_MEGA, GARDEVOIR),
+    FORM_SPECIES_TO_NATIONAL(SABLEYE_MEGA, SABLEYE),
+    FORM_SPECIES_TO_NATIONAL(MAWILE_MEGA, MAWILE),
+    FORM_SPECIES_TO_NATIONAL(AGGRON_MEGA, AGGRON),
+    FORM_SPECIES_TO_NATIONAL(MEDICHAM_MEGA, MEDICHAM),
+    FORM_SPECIES_TO_NATIONAL(MANECTRIC_MEGA, MANECTRIC),
+    FORM_SPECIES_TO_NATIONAL(SHARPEDO_MEGA, SHARPEDO),
+    FORM_SPECIES_TO_NATIONAL(CAMERUPT_MEGA, CAMERUPT),
+    FORM_SPECIES_TO_NATIONAL(ALTARIA_MEGA, ALTARIA),
+    FORM_SPECIES_TO_NATIONAL(BANETTE_MEGA, BANETTE),
+    FORM_SPECIES_TO_NATIONAL(ABSOL_MEGA, ABSOL),
+    FORM_SPECIES_TO_NATIONAL(GLALIE_MEGA, GLALIE),
+    FORM_SPECIES_TO_NATIONAL(SALAMENCE_MEGA, SALAMENCE),
+    FORM_SPECIES_TO_NATIONAL(METAGROSS_MEGA, METAGROSS),
+    FORM_SPECIES_TO_NATIONAL(LATIAS_MEGA, LATIAS),
+    FORM_SPECIES_TO_NATIONAL(LATIOS_MEGA, LATIOS),
+    FORM_SPECIES_TO_NATIONAL(LOPUNNY_MEGA, LOPUNNY),
+    FORM_SPECIES_TO_NATIONAL(GARCHOMP_MEGA, GARCHOMP),
+    FORM_SPECIES_TO_NATIONAL(LUCARIO_MEGA, LUCARIO),
+    FORM_SPECIES_TO_NATIONAL(ABOMASNOW_MEGA, ABOMASNOW),
+    FORM_SPECIES_TO_NATIONAL(GALLADE_MEGA, GALLADE),
+    FORM_SPECIES_TO_NATIONAL(AUDINO_MEGA, AUDINO),
+    FORM_SPECIES_TO_NATIONAL(DIANCIE_MEGA, DIANCIE),
+    FORM_SPECIES_TO_NATIONAL(MILOTIC_MEGA, MILOTIC),
+    FORM_SPECIES_TO_NATIONAL(BUTTERFREE_MEGA, BUTTERFREE),
+    FORM_SPECIES_TO_NATIONAL(MACHAMP_MEGA, MACHAMP),
+    FORM_SPECIES_TO_NATIONAL(KINGLER_MEGA, KINGLER),
+    FORM_SPECIES_TO_NATIONAL(LAPRAS_MEGA, LAPRAS),
+    FORM_SPECIES_TO_NATIONAL(FLYGON_MEGA, FLYGON),
+    FORM_SPECIES_TO_NATIONAL(KINGDRA_MEGA, KINGDRA),
+    // Special Mega + Primals
+    FORM_SPECIES_TO_NATIONAL(RAYQUAZA_MEGA, RAYQUAZA),
+    FORM_SPECIES_TO_NATIONAL(KYOGRE_PRIMAL, KYOGRE),
+    FORM_SPECIES_TO_NATIONAL(GROUDON_PRIMAL, GROUDON),
+    // Alolan Forms
+    FORM_SPECIES_TO_NATIONAL(RATTATA_ALOLAN, RATTATA),
+    FORM_SPECIES_TO_NATIONAL(RATICATE_ALOLAN, RATICATE),
+    FORM_SPECIES_TO_NATIONAL(RAICHU_ALOLAN, RAICHU),
+    FORM_SPECIES_TO_NATIONAL(SANDSHREW_ALOLAN, SANDSHREW),
+    FORM_SPECIES_TO_NATIONAL(SANDSLASH_ALOLAN, SANDSLASH),
+    FORM_SPECIES_TO_NATIONAL(VULPIX_ALOLAN, VULPIX),
+    FORM_SPECIES_TO_NATIONAL(NINETALES_ALOLAN, NINETALES),
+    FORM_SPECIES_TO_NATIONAL(DIGLETT_ALOLAN, DIGLETT),
+    FORM_SPECIES_TO_NATIONAL(DUGTRIO_ALOLAN, DUGTRIO),
+    FORM_SPECIES_TO_NATIONAL(MEOWTH_ALOLAN, MEOWTH),
+    FORM_SPECIES_TO_NATIONAL(PERSIAN_ALOLAN, PERSIAN),
+    FORM_SPECIES_TO_NATIONAL(GEODUDE_ALOLAN, GEODUDE),
+    FORM_SPECIES_TO_NATIONAL(GRAVELER_ALOLAN, GRAVELER),
+    FORM_SPECIES_TO_NATIONAL(GOLEM_ALOLAN, GOLEM),
+    FORM_SPECIES_TO_NATIONAL(GRIMER_ALOLAN, GRIMER),
+    FORM_SPECIES_TO_NATIONAL(MUK_ALOLAN, MUK),
+    FORM_SPECIES_TO_NATIONAL(EXEGGUTOR_ALOLAN, EXEGGUTOR),
+    FORM_SPECIES_TO_NATIONAL(MAROWAK_ALOLAN, MAROWAK),
+    // Galarian Forms
+    FORM_SPECIES_TO_NATIONAL(MEOWTH_GALARIAN, MEOWTH),
+    FORM_SPECIES_TO_NATIONAL(PONYTA_GALARIAN, PONYTA),
+    FORM_SPECIES_TO_NATIONAL(RAPIDASH_GALARIAN, RAPIDASH),
+    FORM_SPECIES_TO_NATIONAL(SLOWPOKE_GALARIAN, SLOWPOKE),
+    FORM_SPECIES_TO_NATIONAL(SLOWBRO_GALARIAN, SLOWBRO),
+    FORM_SPECIES_TO_NATIONAL(FARFETCHD_GALARIAN, FARFETCHD),
+    FORM_SPECIES_TO_NATIONAL(WEEZING_GALARIAN, WEEZING),
+    FORM_SPECIES_TO_NATIONAL(MR_MIME_GALARIAN, MR_MIME),
+    FORM_SPECIES_TO_NATIONAL(ARTICUNO_GALARIAN, ARTICUNO),
+    FORM_SPECIES_TO_NATIONAL(ZAPDOS_GALARIAN, ZAPDOS),
+    FORM_SPECIES_TO_NATIONAL(MOLTRES_GALARIAN, MOLTRES),
+    FORM_SPECIES_TO_NATIONAL(SLOWKING_GALARIAN, SLOWKING),
+    FORM_SPECIES_TO_NATIONAL(CORSOLA_GALARIAN, CORSOLA),
+    FORM_SPECIES_TO_NATIONAL(ZIGZAGOON_GALARIAN, ZIGZAGOON),
+    FORM_SPECIES_TO_NATIONAL(LINOONE_GALARIAN, LINOONE),
+    FORM_SPECIES_TO_NATIONAL(DARUMAKA_GALARIAN, DARUMAKA),
+    FORM_SPECIES_TO_NATIONAL(DARMANITAN_GALARIAN, DARMANITAN),
+    FORM_SPECIES_TO_NATIONAL(YAMASK_GALARIAN, YAMASK),
+    FORM_SPECIES_TO_NATIONAL(STUNFISK_GALARIAN, STUNFISK),
+    // Cosplay Pikachu
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_COSPLAY, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_ROCK_STAR, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_BELLE, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_POP_STAR, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_PH_D, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_LIBRE, PIKACHU),
+    // Cap Pikachu
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_ORIGINAL_CAP, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_HOENN_CAP, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_SINNOH_CAP, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_UNOVA_CAP, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_KALOS_CAP, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_ALOLA_CAP, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_PARTNER_CAP, PIKACHU),
+    FORM_SPECIES_TO_NATIONAL(PIKACHU_WORLD_CAP, PIKACHU),
+    // Pichu
+    FORM_SPECIES_TO_NATIONAL(PICHU_SPIKY_EARED, PICHU),
+    // Unown
+    FORM_SPECIES_TO_NATIONAL(UNOWN_B, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_C, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_D, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_E, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_F, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_G, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_H, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_I, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_J, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_K, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_L, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_M, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_N, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_O, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_P, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_Q, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_R, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_S, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_T, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_U, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_V, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_W, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_X, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_Y, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_Z, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_QMARK, UNOWN),
+    FORM_SPECIES_TO_NATIONAL(UNOWN_EMARK, UNOWN),
+    // Castform
+    FORM_SPECIES_TO_NATIONAL(CASTFORM_SUNNY, CASTFORM),
+    FORM_SPECIES_TO_NATIONAL(CASTFORM_RAINY, CASTFORM),
+    FORM_SPECIES_TO_NATIONAL(CASTFORM_SNOWY, CASTFORM),
+    // Deoxys
+    FORM_SPECIES_TO_NATIONAL(DEOXYS_ATTACK, DEOXYS),
+    FORM_SPECIES_TO_NATIONAL(DEOXYS_DEFENSE, DEOXYS),
+    FORM_SPECIES_TO_NATIONAL(DEOXYS_SPEED, DEOXYS),
+    // Burmy
+    FORM_SPECIES_TO_NATIONAL(BURMY_SANDY_CLOAK, BURMY),
+    FORM_SPECIES_TO_NATIONAL(BURMY_TRASH_CLOAK, BURMY),
+    // Wormadam
+    FORM_SPECIES_TO_NATIONAL(WORMADAM_SANDY_CLOAK, WORMADAM),
+    FORM_SPECIES_TO_NATIONAL(WORMADAM_TRASH_CLOAK, WORMADAM),
+    // Cherrim
+    FORM_SPECIES_TO_NATIONAL(CHERRIM_SUNSHINE, CHERRIM),
+    // Shellos
+    FORM_SPECIES_TO_NATIONAL(SHELLOS_EAST_SEA, SHELLOS),
+    // Gastrodon
+    FORM_SPECIES_TO_NATIONAL(GASTRODON_EAST_SEA, GASTRODON),
+    // Rotom
+    FORM_SPECIES_TO_NATIONAL(ROTOM_HEAT, ROTOM),
+    FORM_SPECIES_TO_NATIONAL(ROTOM_WASH, ROTOM),
+    FORM_SPECIES_TO_NATIONAL(ROTOM_FROST, ROTOM),
+    FORM_SPECIES_TO_NATIONAL(ROTOM_FAN, ROTOM),
+    FORM_SPECIES_TO_NATIONAL(ROTOM_MOW, ROTOM),
+    // Giratina
+    FORM_SPECIES_TO_NATIONAL(GIRATINA_ORIGIN, GIRATINA),
+    // Shaymin
+    FORM_SPECIES_TO_NATIONAL(SHAYMIN_SKY, SHAYMIN),
+    // Arceus
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_FIGHTING, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_FLYING, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_POISON, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_GROUND, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_ROCK, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_BUG, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_GHOST, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_STEEL, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_FIRE, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_WATER, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_GRASS, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_ELECTRIC, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_PSYCHIC, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_ICE, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_DRAGON, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_DARK, ARCEUS),
+    FORM_SPECIES_TO_NATIONAL(ARCEUS_FAIRY, ARCEUS),
+    // Basculin
+    FORM_SPECIES_TO_NATIONAL(BASCULIN_BLUE_STRIPED, BASCULIN),
+    // Darmanitan
+    FORM_SPECIES_TO_NATIONAL(DARMANITAN_ZEN_MODE, DARMANITAN),
+    FORM_SPECIES_TO_NATIONAL(DARMANITAN_ZEN_MODE_GALARIAN, DARMANITAN),
+    // Deerling
+    FORM_SPECIES_TO_NATIONAL(DEERLING_SUMMER, DEERLING),
+    FORM_SPECIES_TO_NATIONAL(DEERLING_AUTUMN, DEERLING),
+    FORM_SPECIES_TO_NATIONAL(DEERLING_WINTER, DEERLING),
+    // Sawsbuck
+    FORM_SPECIES_TO_NATIONAL(SAWSBUCK_SUMMER, SAWSBUCK),
+    FORM_SPECIES_TO_NATIONAL(SAWSBUCK_AUTUMN, SAWSBUCK),
+    FORM_SPECIES_TO_NATIONAL(SAWSBUCK_WINTER, SAWSBUCK),
+    // Therian Forms
+    FORM_SPECIES_TO_NATIONAL(TORNADUS_THERIAN, TORNADUS),
+    FORM_SPECIES_TO_NATIONAL(THUNDURUS_THERIAN, THUNDURUS),
+    FORM_SPECIES_TO_NATIONAL(LANDORUS_THERIAN, LANDORUS),
+    // Kyurem
+    FORM_SPECIES_TO_NATIONAL(KYUREM_BLACK, KYUREM),
+    FORM_SPECIES_TO_NATIONAL(KYUREM_WHITE, KYUREM),
+    // Keldeo
+    FORM_SPECIES_TO_NATIONAL(KELDEO_RESOLUTE, KELDEO),
+    // Meloetta
+    FORM_SPECIES_TO_NATIONAL(MELOETTA_PIROUETTE, MELOETTA),
+    // Genesect
+    FORM_SPECIES_TO_NATIONAL(GENESECT_DOUSE_DRIVE, GENESECT),
+    FORM_SPECIES_TO_NATIONAL(GENESECT_SHOCK_DRIVE, GENESECT),
+    FORM_SPECIES_TO_NATIONAL(GENESECT_BURN_DRIVE, GENESECT),
+    FORM_SPECIES_TO_NATIONAL(GENESECT_CHILL_DRIVE, GENESECT),
+    // Greninja
+    FORM_SPECIES_TO_NATIONAL(GRENINJA_BATTLE_BOND, GRENINJA),
+    FORM_SPECIES_TO_NATIONAL(GRENINJA_ASH, GRENINJA),
+    // Vivillon
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_POLAR, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_TUNDRA, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_CONTINENTAL, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_GARDEN, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_ELEGANT, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_MEADOW, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_MODERN, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_MARINE, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_ARCHIPELAGO, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_HIGH_PLAINS, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_SANDSTORM, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_RIVER, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_MONSOON, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_SAVANNA, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_SUN, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_OCEAN, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_JUNGLE, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_FANCY, VIVILLON),
+    FORM_SPECIES_TO_NATIONAL(VIVILLON_POKE_BALL, VIVILLON),
+    // Flabébé
+    FORM_SPECIES_TO_NATIONAL(FLABEBE_YELLOW_FLOWER, FLABEBE),
+    FORM_SPECIES_TO_NATIONAL(FLABEBE_ORANGE_FLOWER, FLABEBE),
+    FORM_SPECIES_TO_NATIONAL(FLABEBE_BLUE_FLOWER, FLABEBE),
+    FORM_SPECIES_TO_NATIONAL(FLABEBE_WHITE_FLOWER, FLABEBE),
+    // Floette
+    FORM_SPECIES_TO_NATIONAL(FLOETTE_YELLOW_FLOWER, FLOETTE),
+    FORM_SPECIES_TO_NATIONAL(FLOETTE_ORANGE_FLOWER, FLOETTE),
+    FORM_SPECIES_TO_NATIONAL(FLOETTE_BLUE_FLOWER, FLOETTE),
+    FORM_SPECIES_TO_NATIONAL(FLOETTE_WHITE_FLOWER, FLOETTE),
+    FORM_SPECIES_TO_NATIONAL(FLOETTE_ETERNAL_FLOWER, FLOETTE),
+    // Florges
+    FORM_SPECIES_TO_NATIONAL(FLORGES_YELLOW_FLOWER, FLORGES),
+    FORM_SPECIES_TO_NATIONAL(FLORGES_ORANGE_FLOWER, FLORGES),
+    FORM_SPECIES_TO_NATIONAL(FLORGES_BLUE_FLOWER, FLORGES),
+    FORM_SPECIES_TO_NATIONAL(FLORGES_WHITE_FLOWER, FLORGES),
+    // Furfrou
+    FORM_SPECIES_TO_NATIONAL(FURFROU_HEART_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_STAR_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_DIAMOND_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_DEBUTANTE_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_MATRON_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_DANDY_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_LA_REINE_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_KABUKI_TRIM, FURFROU),
+    FORM_SPECIES_TO_NATIONAL(FURFROU_PHARAOH_TRIM, FURFROU),
+    // Meowstic
+    FORM_SPECIES_TO_NATIONAL(MEOWSTIC_FEMALE, MEOWSTIC),
+    // Aegislash
+    FORM_SPECIES_TO_NATIONAL(AEGISLASH_BLADE, AEGISLASH),
+    // Pumpkaboo
+    FORM_SPECIES_TO_NATIONAL(PUMPKABOO_SMALL, PUMPKABOO),
+    FORM_SPECIES_TO_NATIONAL(PUMPKABOO_LARGE, PUMPKABOO),
+    FORM_SPECIES_TO_NATIONAL(PUMPKABOO_SUPER, PUMPKABOO),
+    // Gourgeist
+    FORM_SPECIES_TO_NATIONAL(GOURGEIST_SMALL, GOURGEIST),
+    FORM_SPECIES_TO_NATIONAL(GOURGEIST_LARGE, GOURGEIST),
+    FORM_SPECIES_TO_NATIONAL(GOURGEIST_SUPER, GOURGEIST),
+    // Xerneas
+    FORM_SPECIES_TO_NATIONAL(XERNEAS_ACTIVE, XERNEAS),
+    // Zygarde
+    FORM_SPECIES_TO_NATIONAL(ZYGARDE_10, ZYGARDE),
+    FORM_SPECIES_TO_NATIONAL(ZYGARDE_10_POWER_CONSTRUCT, ZYGARDE),
+    FORM_SPECIES_TO_NATIONAL(ZYGARDE_50_POWER_CONSTRUCT, ZYGARDE),
+    FORM_SPECIES_TO_NATIONAL(ZYGARDE_COMPLETE, ZYGARDE),
+    // Hoopa
+    FORM_SPECIES_TO_NATIONAL(HOOPA_UNBOUND, HOOPA),
+    // Oricorio
+    FORM_SPECIES_TO_NATIONAL(ORICORIO_POM_POM, ORICORIO),
+    FORM_SPECIES_TO_NATIONAL(ORICORIO_PAU, ORICORIO),
+    FORM_SPECIES_TO_NATIONAL(ORICORIO_SENSU, ORICORIO),
+    // Rockruff
+    FORM_SPECIES_TO_NATIONAL(ROCKRUFF_OWN_TEMPO, ROCKRUFF),
+    // Lycanroc
+    FORM_SPECIES_TO_NATIONAL(LYCANROC_MIDNIGHT, LYCANROC),
+    FORM_SPECIES_TO_NATIONAL(LYCANROC_DUSK, LYCANROC),
+    // Wishiwashi
+    FORM_SPECIES_TO_NATIONAL(WISHIWASHI_SCHOOL, WISHIWASHI),
+    // Silvally
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_FIGHTING, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_FLYING, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_POISON, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_GROUND, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_ROCK, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_BUG, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_GHOST, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_STEEL, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_FIRE, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_WATER, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_GRASS, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_ELECTRIC, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_PSYCHIC, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_ICE, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_DRAGON, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_DARK, SILVALLY),
+    FORM_SPECIES_TO_NATIONAL(SILVALLY_FAIRY, SILVALLY),
+    // Minior
+    FORM_SPECIES_TO_NATIONAL(MINIOR_METEOR_ORANGE, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_METEOR_YELLOW, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_METEOR_GREEN, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_METEOR_BLUE, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_METEOR_INDIGO, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_METEOR_VIOLET, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_CORE_RED, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_CORE_ORANGE, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_CORE_YELLOW, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_CORE_GREEN, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_CORE_BLUE, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_CORE_INDIGO, MINIOR),
+    FORM_SPECIES_TO_NATIONAL(MINIOR_CORE_VIOLET, MINIOR),
+    // Mimikyu
+    FORM_SPECIES_TO_NATIONAL(MIMIKYU_BUSTED, MIMIKYU),
+    // Necrozma
+    FORM_SPECIES_TO_NATIONAL(NECROZMA_DUSK_MANE, NECROZMA),
+    FORM_SPECIES_TO_NATIONAL(NECROZMA_DAWN_WINGS, NECROZMA),
+    FORM_SPECIES_TO_NATIONAL(NECROZMA_ULTRA, NECROZMA),
+    // Magearna
+    FORM_SPECIES_TO_NATIONAL(MAGEARNA_ORIGINAL_COLOR, MAGEARNA),
+    // Cramorant
+    FORM_SPECIES_TO_NATIONAL(CRAMORANT_GULPING, CRAMORANT),
+    FORM_SPECIES_TO_NATIONAL(CRAMORANT_GORGING, CRAMORANT),
+    // Toxtricity
+    FORM_SPECIES_TO_NATIONAL(TOXTRICITY_LOW_KEY, TOXTRICITY),
+    // Sinistea
+    FORM_SPECIES_TO_NATIONAL(SINISTEA_ANTIQUE, SINISTEA),
+    // Polteageist
+    FORM_SPECIES_TO_NATIONAL(POLTEAGEIST_ANTIQUE, POLTEAGEIST),
+    // Alcremie
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_RUBY_CREAM, ALCREMIE),
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_MATCHA_CREAM, ALCREMIE),
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_MINT_CREAM, ALCREMIE),
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_LEMON_CREAM, ALCREMIE),
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_SALTED_CREAM, ALCREMIE),
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_RUBY_SWIRL, ALCREMIE),
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_CARAMEL_SWIRL, ALCREMIE),
+    FORM_SPECIES_TO_NATIONAL(ALCREMIE_RAINBOW_SWIRL, ALCREMIE),
+    // Eiscue
+    FORM_SPECIES_TO_NATIONAL(EISCUE_NOICE_FACE, EISCUE),
+    // Indeedee
+    FORM_SPECIES_TO_NATIONAL(INDEEDEE_FEMALE, INDEEDEE),
+    // Morpeko
+    FORM_SPECIES_TO_NATIONAL(MORPEKO_HANGRY, MORPEKO),
+    // Zacian
+    FORM_SPECIES_TO_NATIONAL(ZACIAN_CROWNED_SWORD, ZACIAN),
+    // Zamazenta
+    FORM_SPECIES_TO_NATIONAL(ZAMAZENTA_CROWNED_SHIELD, ZAMAZENTA),
+    // Eternatus
+    FORM_SPECIES_TO_NATIONAL(ETERNATUS_ETERNAMAX, ETERNATUS),
+    // Urshifu
+    FORM_SPECIES_TO_NATIONAL(URSHIFU_RAPID_STRIKE_STYLE, URSHIFU),
+    // Zarude
+    FORM_SPECIES_TO_NATIONAL(ZARUDE_DADA, ZARUDE),
+    // Calyrex
+    FORM_SPECIES_TO_NATIONAL(CALYREX_ICE_RIDER, CALYREX),
+    FORM_SPECIES_TO_NATIONAL(CALYREX_SHADOW_RIDER, CALYREX),
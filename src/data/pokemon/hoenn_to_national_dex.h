@@ -0,0 +1,211 @@
+    HOENN_TO_NATIONAL(TREECKO),
+    HOENN_TO_NATIONAL(GROVYLE),
+    HOENN_TO_NATIONAL(SCEPTILE),
+    HOENN_TO_NATIONAL(TORCHIC),
+    HOENN_TO_NATIONAL(COMBUSKEN),
+    HOENN_TO_NATIONAL(BLAZIKEN),
+    HOENN_TO_NATIONAL(MUDKIP),
+    HOENN_TO_NATIONAL(MARSHTOMP),
+    HOENN_TO_NATIONAL(SWAMPERT),
+    HOENN_TO_NATIONAL(POOCHYENA),
+    HOENN_TO_NATIONAL(MIGHTYENA),
+    HOENN_TO_NATIONAL(ZIGZAGOON),
+    HOENN_TO_NATIONAL(LINOONE),
+    HOENN_TO_NATIONAL(WURMPLE),
+    HOENN_TO_NATIONAL(SILCOON),
+    HOENN_TO_NATIONAL(BEAUTIFLY),
+    HOENN_TO_NATIONAL(CASCOON),
+    HOENN_TO_NATIONAL(DUSTOX),
+    HOENN_TO_NATIONAL(LOTAD),
+    HOENN_TO_NATIONAL(LOMBRE),
+    HOENN_TO_NATIONAL(LUDICOLO),
+    HOENN_TO_NATIONAL(SEEDOT),
+    HOENN_TO_NATIONAL(NUZLEAF),
+    HOENN_TO_NATIONAL(SHIFTRY),
+    HOENN_TO_NATIONAL(TAILLOW),
+    HOENN_TO_NATIONAL(SWELLOW),
+    HOENN_TO_NATIONAL(WINGULL),
+    HOENN_TO_NATIONAL(PELIPPER),
+    HOENN_TO_NATIONAL(RALTS),
+    HOENN_TO_NATIONAL(KIRLIA),
+    HOENN_TO_NATIONAL(GARDEVOIR),
+    HOENN_TO_NATIONAL(GALLADE),
+    HOENN_TO_NATIONAL(SURSKIT),
+    HOENN_TO_NATIONAL(MASQUERAIN),
+    HOENN_TO_NATIONAL(SHROOMISH),
+    HOENN_TO_NATIONAL(BRELOOM),
+    HOENN_TO_NATIONAL(SLAKOTH),
+    HOENN_TO_NATIONAL(VIGOROTH),
+    HOENN_TO_NATIONAL(SLAKING),
+    HOENN_TO_NATIONAL(ABRA),
+    HOENN_TO_NATIONAL(KADABRA),
+    HOENN_TO_NATIONAL(ALAKAZAM),
+    HOENN_TO_NATIONAL(NINCADA),
+    HOENN_TO_NATIONAL(NINJASK),
+    HOENN_TO_NATIONAL(SHEDINJA),
+    HOENN_TO_NATIONAL(WHISMUR),
+    HOENN_TO_NATIONAL(LOUDRED),
+    HOENN_TO_NATIONAL(EXPLOUD),
+    HOENN_TO_NATIONAL(MAKUHITA),
+    HOENN_TO_NATIONAL(HARIYAMA),
+    HOENN_TO_NATIONAL(GOLDEEN),
+    HOENN_TO_NATIONAL(SEAKING),
+    HOENN_TO_NATIONAL(MAGIKARP),
+    HOENN_TO_NATIONAL(GYARADOS),
+    HOENN_TO_NATIONAL(AZURILL),
+    HOENN_TO_NATIONAL(MARILL),
+    HOENN_TO_NATIONAL(AZUMARILL),
+    HOENN_TO_NATIONAL(GEODUDE),
+    HOENN_TO_NATIONAL(GRAVELER),
+    HOENN_TO_NATIONAL(GOLEM),
+    HOENN_TO_NATIONAL(NOSEPASS),
+    HOENN_TO_NATIONAL(PROBOPASS),
+    HOENN_TO_NATIONAL(SKITTY),
+    HOENN_TO_NATIONAL(DELCATTY),
+    HOENN_TO_NATIONAL(ZUBAT),
+    HOENN_TO_NATIONAL(GOLBAT),
+    HOENN_TO_NATIONAL(CROBAT),
+    HOENN_TO_NATIONAL(TENTACOOL),
+    HOENN_TO_NATIONAL(TENTACRUEL),
+    HOENN_TO_NATIONAL(SABLEYE),
+    HOENN_TO_NATIONAL(MAWILE),
+    HOENN_TO_NATIONAL(ARON),
+    HOENN_TO_NATIONAL(LAIRON),
+    HOENN_TO_NATIONAL(AGGRON),
+    HOENN_TO_NATIONAL(MACHOP),
+    HOENN_TO_NATIONAL(MACHOKE),
+    HOENN_TO_NATIONAL(MACHAMP),
+    HOENN_TO_NATIONAL(MEDITITE),
+    HOENN_TO_NATIONAL(MEDICHAM),
+    HOENN_TO_NATIONAL(ELECTRIKE),
+    HOENN_TO_NATIONAL(MANECTRIC),
+    HOENN_TO_NATIONAL(PLUSLE),
+    HOENN_TO_NATIONAL(MINUN),
+    HOENN_TO_NATIONAL(MAGNEMITE),
+    HOENN_TO_NATIONAL(MAGNETON),
+    HOENN_TO_NATIONAL(MAGNEZONE),
+    HOENN_TO_NATIONAL(VOLTORB),
+    HOENN_TO_NATIONAL(ELECTRODE),
+    HOENN_TO_NATIONAL(VOLBEAT),
+    HOENN_TO_NATIONAL(ILLUMISE),
+    HOENN_TO_NATIONAL(ODDISH),
+    HOENN_TO_NATIONAL(GLOOM),
+    HOENN_TO_NATIONAL(VILEPLUME),
+    HOENN_TO_NATIONAL(BELLOSSOM),
+    HOENN_TO_NATIONAL(DODUO),
+    HOENN_TO_NATIONAL(DODRIO),
+    HOENN_TO_NATIONAL(BUDEW),
+    HOENN_TO_NATIONAL(ROSELIA),
+    HOENN_TO_NATIONAL(ROSERADE),
+    HOENN_TO_NATIONAL(GULPIN),
+    HOENN_TO_NATIONAL(SWALOT),
+    HOENN_TO_NATIONAL(CARVANHA),
+    HOENN_TO_NATIONAL(SHARPEDO),
+    HOENN_TO_NATIONAL(WAILMER),
+    HOENN_TO_NATIONAL(WAILORD),
+    HOENN_TO_NATIONAL(NUMEL),
+    HOENN_TO_NATIONAL(CAMERUPT),
+    HOENN_TO_NATIONAL(SLUGMA),
+    HOENN_TO_NATIONAL(MAGCARGO),
+    HOENN_TO_NATIONAL(TORKOAL),
+    HOENN_TO_NATIONAL(GRIMER),
+    HOENN_TO_NATIONAL(MUK),
+    HOENN_TO_NATIONAL(KOFFING),
+    HOENN_TO_NATIONAL(WEEZING),
+    HOENN_TO_NATIONAL(SPOINK),
+    HOENN_TO_NATIONAL(GRUMPIG),
+    HOENN_TO_NATIONAL(SANDSHREW),
+    HOENN_TO_NATIONAL(SANDSLASH),
+    HOENN_TO_NATIONAL(SPINDA),
+    HOENN_TO_NATIONAL(SKARMORY),
+    HOENN_TO_NATIONAL(TRAPINCH),
+    HOENN_TO_NATIONAL(VIBRAVA),
+    HOENN_TO_NATIONAL(FLYGON),
+    HOENN_TO_NATIONAL(CACNEA),
+    HOENN_TO_NATIONAL(CACTURNE),
+    HOENN_TO_NATIONAL(SWABLU),
+    HOENN_TO_NATIONAL(ALTARIA),
+    HOENN_TO_NATIONAL(ZANGOOSE),
+    HOENN_TO_NATIONAL(SEVIPER),
+    HOENN_TO_NATIONAL(LUNATONE),
+    HOENN_TO_NATIONAL(SOLROCK),
+    HOENN_TO_NATIONAL(BARBOACH),
+    HOENN_TO_NATIONAL(WHISCASH),
+    HOENN_TO_NATIONAL(CORPHISH),
+    HOENN_TO_NATIONAL(CRAWDAUNT),
+    HOENN_TO_NATIONAL(BALTOY),
+    HOENN_TO_NATIONAL(CLAYDOL),
+    HOENN_TO_NATIONAL(LILEEP),
+    HOENN_TO_NATIONAL(CRADILY),
+    HOENN_TO_NATIONAL(ANORITH),
+    HOENN_TO_NATIONAL(ARMALDO),
+    HOENN_TO_NATIONAL(IGGLYBUFF),
+    HOENN_TO_NATIONAL(JIGGLYPUFF),
+    HOENN_TO_NATIONAL(WIGGLYTUFF),
+    HOENN_TO_NATIONAL(FEEBAS),
+    HOENN_TO_NATIONAL(MILOTIC),
+    HOENN_TO_NATIONAL(CASTFORM),
+    HOENN_TO_NATIONAL(STARYU),
+    HOENN_TO_NATIONAL(STARMIE),
+    HOENN_TO_NATIONAL(KECLEON),
+    HOENN_TO_NATIONAL(SHUPPET),
+    HOENN_TO_NATIONAL(BANETTE),
+    HOENN_TO_NATIONAL(DUSKULL),
+    HOENN_TO_NATIONAL(DUSCLOPS),
+    HOENN_TO_NATIONAL(DUSKNOIR),
+    HOENN_TO_NATIONAL(TROPIUS),
+    HOENN_TO_NATIONAL(CHINGLING),
+    HOENN_TO_NATIONAL(CHIMECHO),
+    HOENN_TO_NATIONAL(ABSOL),
+    HOENN_TO_NATIONAL(VULPIX),
+    HOENN_TO_NATIONAL(NINETALES),
+    HOENN_TO_NATIONAL(PICHU),
+    HOENN_TO_NATIONAL(PIKACHU),
+    HOENN_TO_NATIONAL(RAICHU),
+    HOENN_TO_NATIONAL(PSYDUCK),
+    HOENN_TO_NATIONAL(GOLDUCK),
+    HOENN_TO_NATIONAL(WYNAUT),
+    HOENN_TO_NATIONAL(WOBBUFFET),
+    HOENN_TO_NATIONAL(NATU),
+    HOENN_TO_NATIONAL(XATU),
+    HOENN_TO_NATIONAL(GIRAFARIG),
+    HOENN_TO_NATIONAL(PHANPY),
+    HOENN_TO_NATIONAL(DONPHAN),
+    HOENN_TO_NATIONAL(PINSIR),
+    HOENN_TO_NATIONAL(HERACROSS),
+    HOENN_TO_NATIONAL(RHYHORN),
+    HOENN_TO_NATIONAL(RHYDON),
+    HOENN_TO_NATIONAL(RHYPERIOR),
+    HOENN_TO_NATIONAL(SNORUNT),
+    HOENN_TO_NATIONAL(GLALIE),
+    HOENN_TO_NATIONAL(FROSLASS),
+    HOENN_TO_NATIONAL(SPHEAL),
+    HOENN_TO_NATIONAL(SEALEO),
+    HOENN_TO_NATIONAL(WALREIN),
+    HOENN_TO_NATIONAL(CLAMPERL),
+    HOENN_TO_NATIONAL(HUNTAIL),
+    HOENN_TO_NATIONAL(GOREBYSS),
+    HOENN_TO_NATIONAL(RELICANTH),
+    HOENN_TO_NATIONAL(CORSOLA),
+    HOENN_TO_NATIONAL(CHINCHOU),
+    HOENN_TO_NATIONAL(LANTURN),
+    HOENN_TO_NATIONAL(LUVDISC),
+    HOENN_TO_NATIONAL(HORSEA),
+    HOENN_TO_NATIONAL(SEADRA),
+    HOENN_TO_NATIONAL(KINGDRA),
+    HOENN_TO_NATIONAL(BAGON),
+    HOENN_TO_NATIONAL(SHELGON),
+    HOENN_TO_NATIONAL(SALAMENCE),
+    HOENN_TO_NATIONAL(BELDUM),
+    HOENN_TO_NATIONAL(METANG),
+    HOENN_TO_NATIONAL(METAGROSS),
+    HOENN_TO_NATIONAL(REGIROCK),
+    HOENN_TO_NATIONAL(REGICE),
+    HOENN_TO_NATIONAL(REGISTEEL),
+    HOENN_TO_NATIONAL(LATIAS),
+    HOENN_TO_NATIONAL(LATIOS),
+    HOENN_TO_NATIONAL(KYOGRE),
+    HOENN_TO_NATIONAL(GROUDON),
+    HOENN_TO_NATIONAL(RAYQUAZA),
+    HOENN_TO_NATIONAL(JIRACHI),
+    HOENN_TO_NATIONAL(DEOXYS),
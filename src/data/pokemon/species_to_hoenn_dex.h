@@ -0,0 +1,211 @@
+    SPECIES_TO_HOENN(TREECKO),
+    SPECIES_TO_HOENN(GROVYLE),
+    SPECIES_TO_HOENN(SCEPTILE),
+    SPECIES_TO_HOENN(TORCHIC),
+    SPECIES_TO_HOENN(COMBUSKEN),
+    SPECIES_TO_HOENN(BLAZIKEN),
+    SPECIES_TO_HOENN(MUDKIP),
+    SPECIES_TO_HOENN(MARSHTOMP),
+    SPECIES_TO_HOENN(SWAMPERT),
+    SPECIES_TO_HOENN(POOCHYENA),
+    SPECIES_TO_HOENN(MIGHTYENA),
+    SPECIES_TO_HOENN(ZIGZAGOON),
+    SPECIES_TO_HOENN(LINOONE),
+    SPECIES_TO_HOENN(WURMPLE),
+    SPECIES_TO_HOENN(SILCOON),
+    SPECIES_TO_HOENN(BEAUTIFLY),
+    SPECIES_TO_HOENN(CASCOON),
+    SPECIES_TO_HOENN(DUSTOX),
+    SPECIES_TO_HOENN(LOTAD),
+    SPECIES_TO_HOENN(LOMBRE),
+    SPECIES_TO_HOENN(LUDICOLO),
+    SPECIES_TO_HOENN(SEEDOT),
+    SPECIES_TO_HOENN(NUZLEAF),
+    SPECIES_TO_HOENN(SHIFTRY),
+    SPECIES_TO_HOENN(TAILLOW),
+    SPECIES_TO_HOENN(SWELLOW),
+    SPECIES_TO_HOENN(WINGULL),
+    SPECIES_TO_HOENN(PELIPPER),
+    SPECIES_TO_HOENN(RALTS),
+    SPECIES_TO_HOENN(KIRLIA),
+    SPECIES_TO_HOENN(GARDEVOIR),
+    SPECIES_TO_HOENN(GALLADE),
+    SPECIES_TO_HOENN(SURSKIT),
+    SPECIES_TO_HOENN(MASQUERAIN),
+    SPECIES_TO_HOENN(SHROOMISH),
+    SPECIES_TO_HOENN(BRELOOM),
+    SPECIES_TO_HOENN(SLAKOTH),
+    SPECIES_TO_HOENN(VIGOROTH),
+    SPECIES_TO_HOENN(SLAKING),
+    SPECIES_TO_HOENN(ABRA),
+    SPECIES_TO_HOENN(KADABRA),
+    SPECIES_TO_HOENN(ALAKAZAM),
+    SPECIES_TO_HOENN(NINCADA),
+    SPECIES_TO_HOENN(NINJASK),
+    SPECIES_TO_HOENN(SHEDINJA),
+    SPECIES_TO_HOENN(WHISMUR),
+    SPECIES_TO_HOENN(LOUDRED),
+    SPECIES_TO_HOENN(EXPLOUD),
+    SPECIES_TO_HOENN(MAKUHITA),
+    SPECIES_TO_HOENN(HARIYAMA),
+    SPECIES_TO_HOENN(GOLDEEN),
+    SPECIES_TO_HOENN(SEAKING),
+    SPECIES_TO_HOENN(MAGIKARP),
+    SPECIES_TO_HOENN(GYARADOS),
+    SPECIES_TO_HOENN(AZURILL),
+    SPECIES_TO_HOENN(MARILL),
+    SPECIES_TO_HOENN(AZUMARILL),
+    SPECIES_TO_HOENN(GEODUDE),
+    SPECIES_TO_HOENN(GRAVELER),
+    SPECIES_TO_HOENN(GOLEM),
+    SPECIES_TO_HOENN(NOSEPASS),
+    SPECIES_TO_HOENN(PROBOPASS),
+    SPECIES_TO_HOENN(SKITTY),
+    SPECIES_TO_HOENN(DELCATTY),
+    SPECIES_TO_HOENN(ZUBAT),
+    SPECIES_TO_HOENN(GOLBAT),
+    SPECIES_TO_HOENN(CROBAT),
+    SPECIES_TO_HOENN(TENTACOOL),
+    SPECIES_TO_HOENN(TENTACRUEL),
+    SPECIES_TO_HOENN(SABLEYE),
+    SPECIES_TO_HOENN(MAWILE),
+    SPECIES_TO_HOENN(ARON),
+    SPECIES_TO_HOENN(LAIRON),
+    SPECIES_TO_HOENN(AGGRON),
+    SPECIES_TO_HOENN(MACHOP),
+    SPECIES_TO_HOENN(MACHOKE),
+    SPECIES_TO_HOENN(MACHAMP),
+    SPECIES_TO_HOENN(MEDITITE),
+    SPECIES_TO_HOENN(MEDICHAM),
+    SPECIES_TO_HOENN(ELECTRIKE),
+    SPECIES_TO_HOENN(MANECTRIC),
+    SPECIES_TO_HOENN(PLUSLE),
+    SPECIES_TO_HOENN(MINUN),
+    SPECIES_TO_HOENN(MAGNEMITE),
+    SPECIES_TO_HOENN(MAGNETON),
+    SPECIES_TO_HOENN(MAGNEZONE),
+    SPECIES_TO_HOENN(VOLTORB),
+    SPECIES_TO_HOENN(ELECTRODE),
+    SPECIES_TO_HOENN(VOLBEAT),
+    SPECIES_TO_HOENN(ILLUMISE),
+    SPECIES_TO_HOENN(ODDISH),
+    SPECIES_TO_HOENN(GLOOM),
+    SPECIES_TO_HOENN(VILEPLUME),
+    SPECIES_TO_HOENN(BELLOSSOM),
+    SPECIES_TO_HOENN(DODUO),
+    SPECIES_TO_HOENN(DODRIO),
+    SPECIES_TO_HOENN(BUDEW),
+    SPECIES_TO_HOENN(ROSELIA),
+    SPECIES_TO_HOENN(ROSERADE),
+    SPECIES_TO_HOENN(GULPIN),
+    SPECIES_TO_HOENN(SWALOT),
+    SPECIES_TO_HOENN(CARVANHA),
+    SPECIES_TO_HOENN(SHARPEDO),
+    SPECIES_TO_HOENN(WAILMER),
+    SPECIES_TO_HOENN(WAILORD),
+    SPECIES_TO_HOENN(NUMEL),
+    SPECIES_TO_HOENN(CAMERUPT),
+    SPECIES_TO_HOENN(SLUGMA),
+    SPECIES_TO_HOENN(MAGCARGO),
+    SPECIES_TO_HOENN(TORKOAL),
+    SPECIES_TO_HOENN(GRIMER),
+    SPECIES_TO_HOENN(MUK),
+    SPECIES_TO_HOENN(KOFFING),
+    SPECIES_TO_HOENN(WEEZING),
+    SPECIES_TO_HOENN(SPOINK),
+    SPECIES_TO_HOENN(GRUMPIG),
+    SPECIES_TO_HOENN(SANDSHREW),
+    SPECIES_TO_HOENN(SANDSLASH),
+    SPECIES_TO_HOENN(SPINDA),
+    SPECIES_TO_HOENN(SKARMORY),
+    SPECIES_TO_HOENN(TRAPINCH),
+    SPECIES_TO_HOENN(VIBRAVA),
+    SPECIES_TO_HOENN(FLYGON),
+    SPECIES_TO_HOENN(CACNEA),
+    SPECIES_TO_HOENN(CACTURNE),
+    SPECIES_TO_HOENN(SWABLU),
+    SPECIES_TO_HOENN(ALTARIA),
+    SPECIES_TO_HOENN(ZANGOOSE),
+    SPECIES_TO_HOENN(SEVIPER),
+    SPECIES_TO_HOENN(LUNATONE),
+    SPECIES_TO_HOENN(SOLROCK),
+    SPECIES_TO_HOENN(BARBOACH),
+    SPECIES_TO_HOENN(WHISCASH),
+    SPECIES_TO_HOENN(CORPHISH),
+    SPECIES_TO_HOENN(CRAWDAUNT),
+    SPECIES_TO_HOENN(BALTOY),
+    SPECIES_TO_HOENN(CLAYDOL),
+    SPECIES_TO_HOENN(LILEEP),
+    SPECIES_TO_HOENN(CRADILY),
+    SPECIES_TO_HOENN(ANORITH),
+    SPECIES_TO_HOENN(ARMALDO),
+    SPECIES_TO_HOENN(IGGLYBUFF),
+    SPECIES_TO_HOENN(JIGGLYPUFF),
+    SPECIES_TO_HOENN(WIGGLYTUFF),
+    SPECIES_TO_HOENN(FEEBAS),
+    SPECIES_TO_HOENN(MILOTIC),
+    SPECIES_TO_HOENN(CASTFORM),
+    SPECIES_TO_HOENN(STARYU),
+    SPECIES_TO_HOENN(STARMIE),
+    SPECIES_TO_HOENN(KECLEON),
+    SPECIES_TO_HOENN(SHUPPET),
+    SPECIES_TO_HOENN(BANETTE),
+    SPECIES_TO_HOENN(DUSKULL),
+    SPECIES_TO_HOENN(DUSCLOPS),
+    SPECIES_TO_HOENN(DUSKNOIR),
+    SPECIES_TO_HOENN(TROPIUS),
+    SPECIES_TO_HOENN(CHINGLING),
+    SPECIES_TO_HOENN(CHIMECHO),
+    SPECIES_TO_HOENN(ABSOL),
+    SPECIES_TO_HOENN(VULPIX),
+    SPECIES_TO_HOENN(NINETALES),
+    SPECIES_TO_HOENN(PICHU),
+    SPECIES_TO_HOENN(PIKACHU),
+    SPECIES_TO_HOENN(RAICHU),
+    SPECIES_TO_HOENN(PSYDUCK),
+    SPECIES_TO_HOENN(GOLDUCK),
+    SPECIES_TO_HOENN(WYNAUT),
+    SPECIES_TO_HOENN(WOBBUFFET),
+    SPECIES_TO_HOENN(NATU),
+    SPECIES_TO_HOENN(XATU),
+    SPECIES_TO_HOENN(GIRAFARIG),
+    SPECIES_TO_HOENN(PHANPY),
+    SPECIES_TO_HOENN(DONPHAN),
+    SPECIES_TO_HOENN(PINSIR),
+    SPECIES_TO_HOENN(HERACROSS),
+    SPECIES_TO_HOENN(RHYHORN),
+    SPECIES_TO_HOENN(RHYDON),
+    SPECIES_TO_HOENN(RHYPERIOR),
+    SPECIES_TO_HOENN(SNORUNT),
+    SPECIES_TO_HOENN(GLALIE),
+    SPECIES_TO_HOENN(FROSLASS),
+    SPECIES_TO_HOENN(SPHEAL),
+    SPECIES_TO_HOENN(SEALEO),
+    SPECIES_TO_HOENN(WALREIN),
+    SPECIES_TO_HOENN(CLAMPERL),
+    SPECIES_TO_HOENN(HUNTAIL),
+    SPECIES_TO_HOENN(GOREBYSS),
+    SPECIES_TO_HOENN(RELICANTH),
+    SPECIES_TO_HOENN(CORSOLA),
+    SPECIES_TO_HOENN(CHINCHOU),
+    SPECIES_TO_HOENN(LANTURN),
+    SPECIES_TO_HOENN(LUVDISC),
+    SPECIES_TO_HOENN(HORSEA),
+    SPECIES_TO_HOENN(SEADRA),
+    SPECIES_TO_HOENN(KINGDRA),
+    SPECIES_TO_HOENN(BAGON),
+    SPECIES_TO_HOENN(SHELGON),
+    SPECIES_TO_HOENN(SALAMENCE),
+    SPECIES_TO_HOENN(BELDUM),
+    SPECIES_TO_HOENN(METANG),
+    SPECIES_TO_HOENN(METAGROSS),
+    SPECIES_TO_HOENN(REGIROCK),
+    SPECIES_TO_HOENN(REGICE),
+    SPECIES_TO_HOENN(REGISTEEL),
+    SPECIES_TO_HOENN(LATIAS),
+    SPECIES_TO_HOENN(LATIOS),
+    SPECIES_TO_HOENN(KYOGRE),
+    SPECIES_TO_HOENN(GROUDON),
+    SPECIES_TO_HOENN(RAYQUAZA),
+    SPECIES_TO_HOENN(JIRACHI),
+    SPECIES_TO_HOENN(DEOXYS),
@@ -0,0 +1,898 @@
+    SPECIES_TO_NATIONAL(BULBASAUR),
+    SPECIES_TO_NATIONAL(IVYSAUR),
+    SPECIES_TO_NATIONAL(VENUSAUR),
+    SPECIES_TO_NATIONAL(CHARMANDER),
+    SPECIES_TO_NATIONAL(CHARMELEON),
+    SPECIES_TO_NATIONAL(CHARIZARD),
+    SPECIES_TO_NATIONAL(SQUIRTLE),
+    SPECIES_TO_NATIONAL(WARTORTLE),
+    SPECIES_TO_NATIONAL(BLASTOISE),
+    SPECIES_TO_NATIONAL(CATERPIE),
+    SPECIES_TO_NATIONAL(METAPOD),
+    SPECIES_TO_NATIONAL(BUTTERFREE),
+    SPECIES_TO_NATIONAL(WEEDLE),
+    SPECIES_TO_NATIONAL(KAKUNA),
+    SPECIES_TO_NATIONAL(BEEDRILL),
+    SPECIES_TO_NATIONAL(PIDGEY),
+    SPECIES_TO_NATIONAL(PIDGEOTTO),
+    SPECIES_TO_NATIONAL(PIDGEOT),
+    SPECIES_TO_NATIONAL(RATTATA),
+    SPECIES_TO_NATIONAL(RATICATE),
+    SPECIES_TO_NATIONAL(SPEAROW),
+    SPECIES_TO_NATIONAL(FEAROW),
+    SPECIES_TO_NATIONAL(EKANS),
+    SPECIES_TO_NATIONAL(ARBOK),
+    SPECIES_TO_NATIONAL(PIKACHU),
+    SPECIES_TO_NATIONAL(RAICHU),
+    SPECIES_TO_NATIONAL(SANDSHREW),
+    SPECIES_TO_NATIONAL(SANDSLASH),
+    SPECIES_TO_NATIONAL(NIDORAN_F),
+    SPECIES_TO_NATIONAL(NIDORINA),
+    SPECIES_TO_NATIONAL(NIDOQUEEN),
+    SPECIES_TO_NATIONAL(NIDORAN_M),
+    SPECIES_TO_NATIONAL(NIDORINO),
+    SPECIES_TO_NATIONAL(NIDOKING),
+    SPECIES_TO_NATIONAL(CLEFAIRY),
+    SPECIES_TO_NATIONAL(CLEFABLE),
+    SPECIES_TO_NATIONAL(VULPIX),
+    SPECIES_TO_NATIONAL(NINETALES),
+    SPECIES_TO_NATIONAL(JIGGLYPUFF),
+    SPECIES_TO_NATIONAL(WIGGLYTUFF),
+    SPECIES_TO_NATIONAL(ZUBAT),
+    SPECIES_TO_NATIONAL(GOLBAT),
+    SPECIES_TO_NATIONAL(ODDISH),
+    SPECIES_TO_NATIONAL(GLOOM),
+    SPECIES_TO_NATIONAL(VILEPLUME),
+    SPECIES_TO_NATIONAL(PARAS),
+    SPECIES_TO_NATIONAL(PARASECT),
+    SPECIES_TO_NATIONAL(VENONAT),
+    SPECIES_TO_NATIONAL(VENOMOTH),
+    SPECIES_TO_NATIONAL(DIGLETT),
+    SPECIES_TO_NATIONAL(DUGTRIO),
+    SPECIES_TO_NATIONAL(MEOWTH),
+    SPECIES_TO_NATIONAL(PERSIAN),
+    SPECIES_TO_NATIONAL(PSYDUCK),
+    SPECIES_TO_NATIONAL(GOLDUCK),
+    SPECIES_TO_NATIONAL(MANKEY),
+    SPECIES_TO_NATIONAL(PRIMEAPE),
+    SPECIES_TO_NATIONAL(GROWLITHE),
+    SPECIES_TO_NATIONAL(ARCANINE),
+    SPECIES_TO_NATIONAL(POLIWAG),
+    SPECIES_TO_NATIONAL(POLIWHIRL),
+    SPECIES_TO_NATIONAL(POLIWRATH),
+    SPECIES_TO_NATIONAL(ABRA),
+    SPECIES_TO_NATIONAL(KADABRA),
+    SPECIES_TO_NATIONAL(ALAKAZAM),
+    SPECIES_TO_NATIONAL(MACHOP),
+    SPECIES_TO_NATIONAL(MACHOKE),
+    SPECIES_TO_NATIONAL(MACHAMP),
+    SPECIES_TO_NATIONAL(BELLSPROUT),
+    SPECIES_TO_NATIONAL(WEEPINBELL),
+    SPECIES_TO_NATIONAL(VICTREEBEL),
+    SPECIES_TO_NATIONAL(TENTACOOL),
+    SPECIES_TO_NATIONAL(TENTACRUEL),
+    SPECIES_TO_NATIONAL(GEODUDE),
+    SPECIES_TO_NATIONAL(GRAVELER),
+    SPECIES_TO_NATIONAL(GOLEM),
+    SPECIES_TO_NATIONAL(PONYTA),
+    SPECIES_TO_NATIONAL(RAPIDASH),
+    SPECIES_TO_NATIONAL(SLOWPOKE),
+    SPECIES_TO_NATIONAL(SLOWBRO),
+    SPECIES_TO_NATIONAL(MAGNEMITE),
+    SPECIES_TO_NATIONAL(MAGNETON),
+    SPECIES_TO_NATIONAL(FARFETCHD),
+    SPECIES_TO_NATIONAL(DODUO),
+    SPECIES_TO_NATIONAL(DODRIO),
+    SPECIES_TO_NATIONAL(SEEL),
+    SPECIES_TO_NATIONAL(DEWGONG),
+    SPECIES_TO_NATIONAL(GRIMER),
+    SPECIES_TO_NATIONAL(MUK),
+    SPECIES_TO_NATIONAL(SHELLDER),
+    SPECIES_TO_NATIONAL(CLOYSTER),
+    SPECIES_TO_NATIONAL(GASTLY),
+    SPECIES_TO_NATIONAL(HAUNTER),
+    SPECIES_TO_NATIONAL(GENGAR),
+    SPECIES_TO_NATIONAL(ONIX),
+    SPECIES_TO_NATIONAL(DROWZEE),
+    SPECIES_TO_NATIONAL(HYPNO),
+    SPECIES_TO_NATIONAL(KRABBY),
+    SPECIES_TO_NATIONAL(KINGLER),
+    SPECIES_TO_NATIONAL(VOLTORB),
+    SPECIES_TO_NATIONAL(ELECTRODE),
+    SPECIES_TO_NATIONAL(EXEGGCUTE),
+    SPECIES_TO_NATIONAL(EXEGGUTOR),
+    SPECIES_TO_NATIONAL(CUBONE),
+    SPECIES_TO_NATIONAL(MAROWAK),
+    SPECIES_TO_NATIONAL(HITMONLEE),
+    SPECIES_TO_NATIONAL(HITMONCHAN),
+    SPECIES_TO_NATIONAL(LICKITUNG),
+    SPECIES_TO_NATIONAL(KOFFING),
+    SPECIES_TO_NATIONAL(WEEZING),
+    SPECIES_TO_NATIONAL(RHYHORN),
+    SPECIES_TO_NATIONAL(RHYDON),
+    SPECIES_TO_NATIONAL(CHANSEY),
+    SPECIES_TO_NATIONAL(TANGELA),
+    SPECIES_TO_NATIONAL(KANGASKHAN),
+    SPECIES_TO_NATIONAL(HORSEA),
+    SPECIES_TO_NATIONAL(SEADRA),
+    SPECIES_TO_NATIONAL(GOLDEEN),
+    SPECIES_TO_NATIONAL(SEAKING),
+    SPECIES_TO_NATIONAL(STARYU),
+    SPECIES_TO_NATIONAL(STARMIE),
+    SPECIES_TO_NATIONAL(MR_MIME),
+    SPECIES_TO_NATIONAL(SCYTHER),
+    SPECIES_TO_NATIONAL(JYNX),
+    SPECIES_TO_NATIONAL(ELECTABUZZ),
+    SPECIES_TO_NATIONAL(MAGMAR),
+    SPECIES_TO_NATIONAL(PINSIR),
+    SPECIES_TO_NATIONAL(TAUROS),
+    SPECIES_TO_NATIONAL(MAGIKARP),
+    SPECIES_TO_NATIONAL(GYARADOS),
+    SPECIES_TO_NATIONAL(LAPRAS),
+    SPECIES_TO_NATIONAL(DITTO),
+    SPECIES_TO_NATIONAL(EEVEE),
+    SPECIES_TO_NATIONAL(VAPOREON),
+    SPECIES_TO_NATIONAL(JOLTEON),
+    SPECIES_TO_NATIONAL(FLAREON),
+    SPECIES_TO_NATIONAL(PORYGON),
+    SPECIES_TO_NATIONAL(OMANYTE),
+    SPECIES_TO_NATIONAL(OMASTAR),
+    SPECIES_TO_NATIONAL(KABUTO),
+    SPECIES_TO_NATIONAL(KABUTOPS),
+    SPECIES_TO_NATIONAL(AERODACTYL),
+    SPECIES_TO_NATIONAL(SNORLAX),
+    SPECIES_TO_NATIONAL(ARTICUNO),
+    SPECIES_TO_NATIONAL(ZAPDOS),
+    SPECIES_TO_NATIONAL(MOLTRES),
+    SPECIES_TO_NATIONAL(DRATINI),
+    SPECIES_TO_NATIONAL(DRAGONAIR),
+    SPECIES_TO_NATIONAL(DRAGONITE),
+    SPECIES_TO_NATIONAL(MEWTWO),
+    SPECIES_TO_NATIONAL(MEW),
+    SPECIES_TO_NATIONAL(CHIKORITA),
+    SPECIES_TO_NATIONAL(BAYLEEF),
+    SPECIES_TO_NATIONAL(MEGANIUM),
+    SPECIES_TO_NATIONAL(CYNDAQUIL),
+    SPECIES_TO_NATIONAL(QUILAVA),
+    SPECIES_TO_NATIONAL(TYPHLOSION),
+    SPECIES_TO_NATIONAL(TOTODILE),
+    SPECIES_TO_NATIONAL(CROCONAW),
+    SPECIES_TO_NATIONAL(FERALIGATR),
+    SPECIES_TO_NATIONAL(SENTRET),
+    SPECIES_TO_NATIONAL(FURRET),
+    SPECIES_TO_NATIONAL(HOOTHOOT),
+    SPECIES_TO_NATIONAL(NOCTOWL),
+    SPECIES_TO_NATIONAL(LEDYBA),
+    SPECIES_TO_NATIONAL(LEDIAN),
+    SPECIES_TO_NATIONAL(SPINARAK),
+    SPECIES_TO_NATIONAL(ARIADOS),
+    SPECIES_TO_NATIONAL(CROBAT),
+    SPECIES_TO_NATIONAL(CHINCHOU),
+    SPECIES_TO_NATIONAL(LANTURN),
+    SPECIES_TO_NATIONAL(PICHU),
+    SPECIES_TO_NATIONAL(CLEFFA),
+    SPECIES_TO_NATIONAL(IGGLYBUFF),
+    SPECIES_TO_NATIONAL(TOGEPI),
+    SPECIES_TO_NATIONAL(TOGETIC),
+    SPECIES_TO_NATIONAL(NATU),
+    SPECIES_TO_NATIONAL(XATU),
+    SPECIES_TO_NATIONAL(MAREEP),
+    SPECIES_TO_NATIONAL(FLAAFFY),
+    SPECIES_TO_NATIONAL(AMPHAROS),
+    SPECIES_TO_NATIONAL(BELLOSSOM),
+    SPECIES_TO_NATIONAL(MARILL),
+    SPECIES_TO_NATIONAL(AZUMARILL),
+    SPECIES_TO_NATIONAL(SUDOWOODO),
+    SPECIES_TO_NATIONAL(POLITOED),
+    SPECIES_TO_NATIONAL(HOPPIP),
+    SPECIES_TO_NATIONAL(SKIPLOOM),
+    SPECIES_TO_NATIONAL(JUMPLUFF),
+    SPECIES_TO_NATIONAL(AIPOM),
+    SPECIES_TO_NATIONAL(SUNKERN),
+    SPECIES_TO_NATIONAL(SUNFLORA),
+    SPECIES_TO_NATIONAL(YANMA),
+    SPECIES_TO_NATIONAL(WOOPER),
+    SPECIES_TO_NATIONAL(QUAGSIRE),
+    SPECIES_TO_NATIONAL(ESPEON),
+    SPECIES_TO_NATIONAL(UMBREON),
+    SPECIES_TO_NATIONAL(MURKROW),
+    SPECIES_TO_NATIONAL(SLOWKING),
+    SPECIES_TO_NATIONAL(MISDREAVUS),
+    SPECIES_TO_NATIONAL(UNOWN),
+    SPECIES_TO_NATIONAL(WOBBUFFET),
+    SPECIES_TO_NATIONAL(GIRAFARIG),
+    SPECIES_TO_NATIONAL(PINECO),
+    SPECIES_TO_NATIONAL(FORRETRESS),
+    SPECIES_TO_NATIONAL(DUNSPARCE),
+    SPECIES_TO_NATIONAL(GLIGAR),
+    SPECIES_TO_NATIONAL(STEELIX),
+    SPECIES_TO_NATIONAL(SNUBBULL),
+    SPECIES_TO_NATIONAL(GRANBULL),
+    SPECIES_TO_NATIONAL(QWILFISH),
+    SPECIES_TO_NATIONAL(SCIZOR),
+    SPECIES_TO_NATIONAL(SHUCKLE),
+    SPECIES_TO_NATIONAL(HERACROSS),
+    SPECIES_TO_NATIONAL(SNEASEL),
+    SPECIES_TO_NATIONAL(TEDDIURSA),
+    SPECIES_TO_NATIONAL(URSARING),
+    SPECIES_TO_NATIONAL(SLUGMA),
+    SPECIES_TO_NATIONAL(MAGCARGO),
+    SPECIES_TO_NATIONAL(SWINUB),
+    SPECIES_TO_NATIONAL(PILOSWINE),
+    SPECIES_TO_NATIONAL(CORSOLA),
+    SPECIES_TO_NATIONAL(REMORAID),
+    SPECIES_TO_NATIONAL(OCTILLERY),
+    SPECIES_TO_NATIONAL(DELIBIRD),
+    SPECIES_TO_NATIONAL(MANTINE),
+    SPECIES_TO_NATIONAL(SKARMORY),
+    SPECIES_TO_NATIONAL(HOUNDOUR),
+    SPECIES_TO_NATIONAL(HOUNDOOM),
+    SPECIES_TO_NATIONAL(KINGDRA),
+    SPECIES_TO_NATIONAL(PHANPY),
+    SPECIES_TO_NATIONAL(DONPHAN),
+    SPECIES_TO_NATIONAL(PORYGON2),
+    SPECIES_TO_NATIONAL(STANTLER),
+    SPECIES_TO_NATIONAL(SMEARGLE),
+    SPECIES_TO_NATIONAL(TYROGUE),
+    SPECIES_TO_NATIONAL(HITMONTOP),
+    SPECIES_TO_NATIONAL(SMOOCHUM),
+    SPECIES_TO_NATIONAL(ELEKID),
+    SPECIES_TO_NATIONAL(MAGBY),
+    SPECIES_TO_NATIONAL(MILTANK),
+    SPECIES_TO_NATIONAL(BLISSEY),
+    SPECIES_TO_NATIONAL(RAIKOU),
+    SPECIES_TO_NATIONAL(ENTEI),
+    SPECIES_TO_NATIONAL(SUICUNE),
+    SPECIES_TO_NATIONAL(LARVITAR),
+    SPECIES_TO_NATIONAL(PUPITAR),
+    SPECIES_TO_NATIONAL(TYRANITAR),
+    SPECIES_TO_NATIONAL(LUGIA),
+    SPECIES_TO_NATIONAL(HO_OH),
+    SPECIES_TO_NATIONAL(CELEBI),
+    SPECIES_TO_NATIONAL(TREECKO),
+    SPECIES_TO_NATIONAL(GROVYLE),
+    SPECIES_TO_NATIONAL(SCEPTILE),
+    SPECIES_TO_NATIONAL(TORCHIC),
+    SPECIES_TO_NATIONAL(COMBUSKEN),
+    SPECIES_TO_NATIONAL(BLAZIKEN),
+    SPECIES_TO_NATIONAL(MUDKIP),
+    SPECIES_TO_NATIONAL(MARSHTOMP),
+    SPECIES_TO_NATIONAL(SWAMPERT),
+    SPECIES_TO_NATIONAL(POOCHYENA),
+    SPECIES_TO_NATIONAL(MIGHTYENA),
+    SPECIES_TO_NATIONAL(ZIGZAGOON),
+    SPECIES_TO_NATIONAL(LINOONE),
+    SPECIES_TO_NATIONAL(WURMPLE),
+    SPECIES_TO_NATIONAL(SILCOON),
+    SPECIES_TO_NATIONAL(BEAUTIFLY),
+    SPECIES_TO_NATIONAL(CASCOON),
+    SPECIES_TO_NATIONAL(DUSTOX),
+    SPECIES_TO_NATIONAL(LOTAD),
+    SPECIES_TO_NATIONAL(LOMBRE),
+    SPECIES_TO_NATIONAL(LUDICOLO),
+    SPECIES_TO_NATIONAL(SEEDOT),
+    SPECIES_TO_NATIONAL(NUZLEAF),
+    SPECIES_TO_NATIONAL(SHIFTRY),
+    SPECIES_TO_NATIONAL(TAILLOW),
+    SPECIES_TO_NATIONAL(SWELLOW),
+    SPECIES_TO_NATIONAL(WINGULL),
+    SPECIES_TO_NATIONAL(PELIPPER),
+    SPECIES_TO_NATIONAL(RALTS),
+    SPECIES_TO_NATIONAL(KIRLIA),
+    SPECIES_TO_NATIONAL(GARDEVOIR),
+    SPECIES_TO_NATIONAL(SURSKIT),
+    SPECIES_TO_NATIONAL(MASQUERAIN),
+    SPECIES_TO_NATIONAL(SHROOMISH),
+    SPECIES_TO_NATIONAL(BRELOOM),
+    SPECIES_TO_NATIONAL(SLAKOTH),
+    SPECIES_TO_NATIONAL(VIGOROTH),
+    SPECIES_TO_NATIONAL(SLAKING),
+    SPECIES_TO_NATIONAL(NINCADA),
+    SPECIES_TO_NATIONAL(NINJASK),
+    SPECIES_TO_NATIONAL(SHEDINJA),
+    SPECIES_TO_NATIONAL(WHISMUR),
+    SPECIES_TO_NATIONAL(LOUDRED),
+    SPECIES_TO_NATIONAL(EXPLOUD),
+    SPECIES_TO_NATIONAL(MAKUHITA),
+    SPECIES_TO_NATIONAL(HARIYAMA),
+    SPECIES_TO_NATIONAL(AZURILL),
+    SPECIES_TO_NATIONAL(NOSEPASS),
+    SPECIES_TO_NATIONAL(SKITTY),
+    SPECIES_TO_NATIONAL(DELCATTY),
+    SPECIES_TO_NATIONAL(SABLEYE),
+    SPECIES_TO_NATIONAL(MAWILE),
+    SPECIES_TO_NATIONAL(ARON),
+    SPECIES_TO_NATIONAL(LAIRON),
+    SPECIES_TO_NATIONAL(AGGRON),
+    SPECIES_TO_NATIONAL(MEDITITE),
+    SPECIES_TO_NATIONAL(MEDICHAM),
+    SPECIES_TO_NATIONAL(ELECTRIKE),
+    SPECIES_TO_NATIONAL(MANECTRIC),
+    SPECIES_TO_NATIONAL(PLUSLE),
+    SPECIES_TO_NATIONAL(MINUN),
+    SPECIES_TO_NATIONAL(VOLBEAT),
+    SPECIES_TO_NATIONAL(ILLUMISE),
+    SPECIES_TO_NATIONAL(ROSELIA),
+    SPECIES_TO_NATIONAL(GULPIN),
+    SPECIES_TO_NATIONAL(SWALOT),
+    SPECIES_TO_NATIONAL(CARVANHA),
+    SPECIES_TO_NATIONAL(SHARPEDO),
+    SPECIES_TO_NATIONAL(WAILMER),
+    SPECIES_TO_NATIONAL(WAILORD),
+    SPECIES_TO_NATIONAL(NUMEL),
+    SPECIES_TO_NATIONAL(CAMERUPT),
+    SPECIES_TO_NATIONAL(TORKOAL),
+    SPECIES_TO_NATIONAL(SPOINK),
+    SPECIES_TO_NATIONAL(GRUMPIG),
+    SPECIES_TO_NATIONAL(SPINDA),
+    SPECIES_TO_NATIONAL(TRAPINCH),
+    SPECIES_TO_NATIONAL(VIBRAVA),
+    SPECIES_TO_NATIONAL(FLYGON),
+    SPECIES_TO_NATIONAL(CACNEA),
+    SPECIES_TO_NATIONAL(CACTURNE),
+    SPECIES_TO_NATIONAL(SWABLU),
+    SPECIES_TO_NATIONAL(ALTARIA),
+    SPECIES_TO_NATIONAL(ZANGOOSE),
+    SPECIES_TO_NATIONAL(SEVIPER),
+    SPECIES_TO_NATIONAL(LUNATONE),
+    SPECIES_TO_NATIONAL(SOLROCK),
+    SPECIES_TO_NATIONAL(BARBOACH),
+    SPECIES_TO_NATIONAL(WHISCASH),
+    SPECIES_TO_NATIONAL(CORPHISH),
+    SPECIES_TO_NATIONAL(CRAWDAUNT),
+    SPECIES_TO_NATIONAL(BALTOY),
+    SPECIES_TO_NATIONAL(CLAYDOL),
+    SPECIES_TO_NATIONAL(LILEEP),
+    SPECIES_TO_NATIONAL(CRADILY),
+    SPECIES_TO_NATIONAL(ANORITH),
+    SPECIES_TO_NATIONAL(ARMALDO),
+    SPECIES_TO_NATIONAL(FEEBAS),
+    SPECIES_TO_NATIONAL(MILOTIC),
+    SPECIES_TO_NATIONAL(CASTFORM),
+    SPECIES_TO_NATIONAL(KECLEON),
+    SPECIES_TO_NATIONAL(SHUPPET),
+    SPECIES_TO_NATIONAL(BANETTE),
+    SPECIES_TO_NATIONAL(DUSKULL),
+    SPECIES_TO_NATIONAL(DUSCLOPS),
+    SPECIES_TO_NATIONAL(TROPIUS),
+    SPECIES_TO_NATIONAL(CHIMECHO),
+    SPECIES_TO_NATIONAL(ABSOL),
+    SPECIES_TO_NATIONAL(WYNAUT),
+    SPECIES_TO_NATIONAL(SNORUNT),
+    SPECIES_TO_NATIONAL(GLALIE),
+    SPECIES_TO_NATIONAL(SPHEAL),
+    SPECIES_TO_NATIONAL(SEALEO),
+    SPECIES_TO_NATIONAL(WALREIN),
+    SPECIES_TO_NATIONAL(CLAMPERL),
+    SPECIES_TO_NATIONAL(HUNTAIL),
+    SPECIES_TO_NATIONAL(GOREBYSS),
+    SPECIES_TO_NATIONAL(RELICANTH),
+    SPECIES_TO_NATIONAL(LUVDISC),
+    SPECIES_TO_NATIONAL(BAGON),
+    SPECIES_TO_NATIONAL(SHELGON),
+    SPECIES_TO_NATIONAL(SALAMENCE),
+    SPECIES_TO_NATIONAL(BELDUM),
+    SPECIES_TO_NATIONAL(METANG),
+    SPECIES_TO_NATIONAL(METAGROSS),
+    SPECIES_TO_NATIONAL(REGIROCK),
+    SPECIES_TO_NATIONAL(REGICE),
+    SPECIES_TO_NATIONAL(REGISTEEL),
+    SPECIES_TO_NATIONAL(LATIAS),
+    SPECIES_TO_NATIONAL(LATIOS),
+    SPECIES_TO_NATIONAL(KYOGRE),
+    SPECIES_TO_NATIONAL(GROUDON),
+    SPECIES_TO_NATIONAL(RAYQUAZA),
+    SPECIES_TO_NATIONAL(JIRACHI),
+    SPECIES_TO_NATIONAL(DEOXYS),
+    SPECIES_TO_NATIONAL(TURTWIG),
+    SPECIES_TO_NATIONAL(GROTLE),
+    SPECIES_TO_NATIONAL(TORTERRA),
+    SPECIES_TO_NATIONAL(CHIMCHAR),
+    SPECIES_TO_NATIONAL(MONFERNO),
+    SPECIES_TO_NATIONAL(INFERNAPE),
+    SPECIES_TO_NATIONAL(PIPLUP),
+    SPECIES_TO_NATIONAL(PRINPLUP),
+    SPECIES_TO_NATIONAL(EMPOLEON),
+    SPECIES_TO_NATIONAL(STARLY),
+    SPECIES_TO_NATIONAL(STARAVIA),
+    SPECIES_TO_NATIONAL(STARAPTOR),
+    SPECIES_TO_NATIONAL(BIDOOF),
+    SPECIES_TO_NATIONAL(BIBAREL),
+    SPECIES_TO_NATIONAL(KRICKETOT),
+    SPECIES_TO_NATIONAL(KRICKETUNE),
+    SPECIES_TO_NATIONAL(SHINX),
+    SPECIES_TO_NATIONAL(LUXIO),
+    SPECIES_TO_NATIONAL(LUXRAY),
+    SPECIES_TO_NATIONAL(BUDEW),
+    SPECIES_TO_NATIONAL(ROSERADE),
+    SPECIES_TO_NATIONAL(CRANIDOS),
+    SPECIES_TO_NATIONAL(RAMPARDOS),
+    SPECIES_TO_NATIONAL(SHIELDON),
+    SPECIES_TO_NATIONAL(BASTIODON),
+    SPECIES_TO_NATIONAL(BURMY),
+    SPECIES_TO_NATIONAL(WORMADAM),
+    SPECIES_TO_NATIONAL(MOTHIM),
+    SPECIES_TO_NATIONAL(COMBEE),
+    SPECIES_TO_NATIONAL(VESPIQUEN),
+    SPECIES_TO_NATIONAL(PACHIRISU),
+    SPECIES_TO_NATIONAL(BUIZEL),
+    SPECIES_TO_NATIONAL(FLOATZEL),
+    SPECIES_TO_NATIONAL(CHERUBI),
+    SPECIES_TO_NATIONAL(CHERRIM),
+    SPECIES_TO_NATIONAL(SHELLOS),
+    SPECIES_TO_NATIONAL(GASTRODON),
+    SPECIES_TO_NATIONAL(AMBIPOM),
+    SPECIES_TO_NATIONAL(DRIFLOON),
+    SPECIES_TO_NATIONAL(DRIFBLIM),
+    SPECIES_TO_NATIONAL(BUNEARY),
+    SPECIES_TO_NATIONAL(LOPUNNY),
+    SPECIES_TO_NATIONAL(MISMAGIUS),
+    SPECIES_TO_NATIONAL(HONCHKROW),
+    SPECIES_TO_NATIONAL(GLAMEOW),
+    SPECIES_TO_NATIONAL(PURUGLY),
+    SPECIES_TO_NATIONAL(CHINGLING),
+    SPECIES_TO_NATIONAL(STUNKY),
+    SPECIES_TO_NATIONAL(SKUNTANK),
+    SPECIES_TO_NATIONAL(BRONZOR),
+    SPECIES_TO_NATIONAL(BRONZONG),
+    SPECIES_TO_NATIONAL(BONSLY),
+    SPECIES_TO_NATIONAL(MIME_JR),
+    SPECIES_TO_NATIONAL(HAPPINY),
+    SPECIES_TO_NATIONAL(CHATOT),
+    SPECIES_TO_NATIONAL(SPIRITOMB),
+    SPECIES_TO_NATIONAL(GIBLE),
+    SPECIES_TO_NATIONAL(GABITE),
+    SPECIES_TO_NATIONAL(GARCHOMP),
+    SPECIES_TO_NATIONAL(MUNCHLAX),
+    SPECIES_TO_NATIONAL(RIOLU),
+    SPECIES_TO_NATIONAL(LUCARIO),
+    SPECIES_TO_NATIONAL(HIPPOPOTAS),
+    SPECIES_TO_NATIONAL(HIPPOWDON),
+    SPECIES_TO_NATIONAL(SKORUPI),
+    SPECIES_TO_NATIONAL(DRAPION),
+    SPECIES_TO_NATIONAL(CROAGUNK),
+    SPECIES_TO_NATIONAL(TOXICROAK),
+    SPECIES_TO_NATIONAL(CARNIVINE),
+    SPECIES_TO_NATIONAL(FINNEON),
+    SPECIES_TO_NATIONAL(LUMINEON),
+    SPECIES_TO_NATIONAL(MANTYKE),
+    SPECIES_TO_NATIONAL(SNOVER),
+    SPECIES_TO_NATIONAL(ABOMASNOW),
+    SPECIES_TO_NATIONAL(WEAVILE),
+    SPECIES_TO_NATIONAL(MAGNEZONE),
+    SPECIES_TO_NATIONAL(LICKILICKY),
+    SPECIES_TO_NATIONAL(RHYPERIOR),
+    SPECIES_TO_NATIONAL(TANGROWTH),
+    SPECIES_TO_NATIONAL(ELECTIVIRE),
+    SPECIES_TO_NATIONAL(MAGMORTAR),
+    SPECIES_TO_NATIONAL(TOGEKISS),
+    SPECIES_TO_NATIONAL(YANMEGA),
+    SPECIES_TO_NATIONAL(LEAFEON),
+    SPECIES_TO_NATIONAL(GLACEON),
+    SPECIES_TO_NATIONAL(GLISCOR),
+    SPECIES_TO_NATIONAL(MAMOSWINE),
+    SPECIES_TO_NATIONAL(PORYGON_Z),
+    SPECIES_TO_NATIONAL(GALLADE),
+    SPECIES_TO_NATIONAL(PROBOPASS),
+    SPECIES_TO_NATIONAL(DUSKNOIR),
+    SPECIES_TO_NATIONAL(FROSLASS),
+    SPECIES_TO_NATIONAL(ROTOM),
+    SPECIES_TO_NATIONAL(UXIE),
+    SPECIES_TO_NATIONAL(MESPRIT),
+    SPECIES_TO_NATIONAL(AZELF),
+    SPECIES_TO_NATIONAL(DIALGA),
+    SPECIES_TO_NATIONAL(PALKIA),
+    SPECIES_TO_NATIONAL(HEATRAN),
+    SPECIES_TO_NATIONAL(REGIGIGAS),
+    SPECIES_TO_NATIONAL(GIRATINA),
+    SPECIES_TO_NATIONAL(CRESSELIA),
+    SPECIES_TO_NATIONAL(PHIONE),
+    SPECIES_TO_NATIONAL(MANAPHY),
+    SPECIES_TO_NATIONAL(DARKRAI),
+    SPECIES_TO_NATIONAL(SHAYMIN),
+    SPECIES_TO_NATIONAL(ARCEUS),
+    SPECIES_TO_NATIONAL(VICTINI),
+    SPECIES_TO_NATIONAL(SNIVY),
+    SPECIES_TO_NATIONAL(SERVINE),
+    SPECIES_TO_NATIONAL(SERPERIOR),
+    SPECIES_TO_NATIONAL(TEPIG),
+    SPECIES_TO_NATIONAL(PIGNITE),
+    SPECIES_TO_NATIONAL(EMBOAR),
+    SPECIES_TO_NATIONAL(OSHAWOTT),
+    SPECIES_TO_NATIONAL(DEWOTT),
+    SPECIES_TO_NATIONAL(SAMUROTT),
+    SPECIES_TO_NATIONAL(PATRAT),
+    SPECIES_TO_NATIONAL(WATCHOG),
+    SPECIES_TO_NATIONAL(LILLIPUP),
+    SPECIES_TO_NATIONAL(HERDIER),
+    SPECIES_TO_NATIONAL(STOUTLAND),
+    SPECIES_TO_NATIONAL(PURRLOIN),
+    SPECIES_TO_NATIONAL(LIEPARD),
+    SPECIES_TO_NATIONAL(PANSAGE),
+    SPECIES_TO_NATIONAL(SIMISAGE),
+    SPECIES_TO_NATIONAL(PANSEAR),
+    SPECIES_TO_NATIONAL(SIMISEAR),
+    SPECIES_TO_NATIONAL(PANPOUR),
+    SPECIES_TO_NATIONAL(SIMIPOUR),
+    SPECIES_TO_NATIONAL(MUNNA),
+    SPECIES_TO_NATIONAL(MUSHARNA),
+    SPECIES_TO_NATIONAL(PIDOVE),
+    SPECIES_TO_NATIONAL(TRANQUILL),
+    SPECIES_TO_NATIONAL(UNFEZANT),
+    SPECIES_TO_NATIONAL(BLITZLE),
+    SPECIES_TO_NATIONAL(ZEBSTRIKA),
+    SPECIES_TO_NATIONAL(ROGGENROLA),
+    SPECIES_TO_NATIONAL(BOLDORE),
+    SPECIES_TO_NATIONAL(GIGALITH),
+    SPECIES_TO_NATIONAL(WOOBAT),
+    SPECIES_TO_NATIONAL(SWOOBAT),
+    SPECIES_TO_NATIONAL(DRILBUR),
+    SPECIES_TO_NATIONAL(EXCADRILL),
+    SPECIES_TO_NATIONAL(AUDINO),
+    SPECIES_TO_NATIONAL(TIMBURR),
+    SPECIES_TO_NATIONAL(GURDURR),
+    SPECIES_TO_NATIONAL(CONKELDURR),
+    SPECIES_TO_NATIONAL(TYMPOLE),
+    SPECIES_TO_NATIONAL(PALPITOAD),
+    SPECIES_TO_NATIONAL(SEISMITOAD),
+    SPECIES_TO_NATIONAL(THROH),
+    SPECIES_TO_NATIONAL(SAWK),
+    SPECIES_TO_NATIONAL(SEWADDLE),
+    SPECIES_TO_NATIONAL(SWADLOON),
+    SPECIES_TO_NATIONAL(LEAVANNY),
+    SPECIES_TO_NATIONAL(VENIPEDE),
+    SPECIES_TO_NATIONAL(WHIRLIPEDE),
+    SPECIES_TO_NATIONAL(SCOLIPEDE),
+    SPECIES_TO_NATIONAL(COTTONEE),
+    SPECIES_TO_NATIONAL(WHIMSICOTT),
+    SPECIES_TO_NATIONAL(PETILIL),
+    SPECIES_TO_NATIONAL(LILLIGANT),
+    SPECIES_TO_NATIONAL(BASCULIN),
+    SPECIES_TO_NATIONAL(SANDILE),
+    SPECIES_TO_NATIONAL(KROKOROK),
+    SPECIES_TO_NATIONAL(KROOKODILE),
+    SPECIES_TO_NATIONAL(DARUMAKA),
+    SPECIES_TO_NATIONAL(DARMANITAN),
+    SPECIES_TO_NATIONAL(MARACTUS),
+    SPECIES_TO_NATIONAL(DWEBBLE),
+    SPECIES_TO_NATIONAL(CRUSTLE),
+    SPECIES_TO_NATIONAL(SCRAGGY),
+    SPECIES_TO_NATIONAL(SCRAFTY),
+    SPECIES_TO_NATIONAL(SIGILYPH),
+    SPECIES_TO_NATIONAL(YAMASK),
+    SPECIES_TO_NATIONAL(COFAGRIGUS),
+    SPECIES_TO_NATIONAL(TIRTOUGA),
+    SPECIES_TO_NATIONAL(CARRACOSTA),
+    SPECIES_TO_NATIONAL(ARCHEN),
+    SPECIES_TO_NATIONAL(ARCHEOPS),
+    SPECIES_TO_NATIONAL(TRUBBISH),
+    SPECIES_TO_NATIONAL(GARBODOR),
+    SPECIES_TO_NATIONAL(ZORUA),
+    SPECIES_TO_NATIONAL(ZOROARK),
+    SPECIES_TO_NATIONAL(MINCCINO),
+    SPECIES_TO_NATIONAL(CINCCINO),
+    SPECIES_TO_NATIONAL(GOTHITA),
+    SPECIES_TO_NATIONAL(GOTHORITA),
+    SPECIES_TO_NATIONAL(GOTHITELLE),
+    SPECIES_TO_NATIONAL(SOLOSIS),
+    SPECIES_TO_NATIONAL(DUOSION),
+    SPECIES_TO_NATIONAL(REUNICLUS),
+    SPECIES_TO_NATIONAL(DUCKLETT),
+    SPECIES_TO_NATIONAL(SWANNA),
+    SPECIES_TO_NATIONAL(VANILLITE),
+    SPECIES_TO_NATIONAL(VANILLISH),
+    SPECIES_TO_NATIONAL(VANILLUXE),
+    SPECIES_TO_NATIONAL(DEERLING),
+    SPECIES_TO_NATIONAL(SAWSBUCK),
+    SPECIES_TO_NATIONAL(EMOLGA),
+    SPECIES_TO_NATIONAL(KARRABLAST),
+    SPECIES_TO_NATIONAL(ESCAVALIER),
+    SPECIES_TO_NATIONAL(FOONGUS),
+    SPECIES_TO_NATIONAL(AMOONGUSS),
+    SPECIES_TO_NATIONAL(FRILLISH),
+    SPECIES_TO_NATIONAL(JELLICENT),
+    SPECIES_TO_NATIONAL(ALOMOMOLA),
+    SPECIES_TO_NATIONAL(JOLTIK),
+    SPECIES_TO_NATIONAL(GALVANTULA),
+    SPECIES_TO_NATIONAL(FERROSEED),
+    SPECIES_TO_NATIONAL(FERROTHORN),
+    SPECIES_TO_NATIONAL(KLINK),
+    SPECIES_TO_NATIONAL(KLANG),
+    SPECIES_TO_NATIONAL(KLINKLANG),
+    SPECIES_TO_NATIONAL(TYNAMO),
+    SPECIES_TO_NATIONAL(EELEKTRIK),
+    SPECIES_TO_NATIONAL(EELEKTROSS),
+    SPECIES_TO_NATIONAL(ELGYEM),
+    SPECIES_TO_NATIONAL(BEHEEYEM),
+    SPECIES_TO_NATIONAL(LITWICK),
+    SPECIES_TO_NATIONAL(LAMPENT),
+    SPECIES_TO_NATIONAL(CHANDELURE),
+    SPECIES_TO_NATIONAL(AXEW),
+    SPECIES_TO_NATIONAL(FRAXURE),
+    SPECIES_TO_NATIONAL(HAXORUS),
+    SPECIES_TO_NATIONAL(CUBCHOO),
+    SPECIES_TO_NATIONAL(BEARTIC),
+    SPECIES_TO_NATIONAL(CRYOGONAL),
+    SPECIES_TO_NATIONAL(SHELMET),
+    SPECIES_TO_NATIONAL(ACCELGOR),
+    SPECIES_TO_NATIONAL(STUNFISK),
+    SPECIES_TO_NATIONAL(MIENFOO),
+    SPECIES_TO_NATIONAL(MIENSHAO),
+    SPECIES_TO_NATIONAL(DRUDDIGON),
+    SPECIES_TO_NATIONAL(GOLETT),
+    SPECIES_TO_NATIONAL(GOLURK),
+    SPECIES_TO_NATIONAL(PAWNIARD),
+    SPECIES_TO_NATIONAL(BISHARP),
+    SPECIES_TO_NATIONAL(BOUFFALANT),
+    SPECIES_TO_NATIONAL(RUFFLET),
+    SPECIES_TO_NATIONAL(BRAVIARY),
+    SPECIES_TO_NATIONAL(VULLABY),
+    SPECIES_TO_NATIONAL(MANDIBUZZ),
+    SPECIES_TO_NATIONAL(HEATMOR),
+    SPECIES_TO_NATIONAL(DURANT),
+    SPECIES_TO_NATIONAL(DEINO),
+    SPECIES_TO_NATIONAL(ZWEILOUS),
+    SPECIES_TO_NATIONAL(HYDREIGON),
+    SPECIES_TO_NATIONAL(LARVESTA),
+    SPECIES_TO_NATIONAL(VOLCARONA),
+    SPECIES_TO_NATIONAL(COBALION),
+    SPECIES_TO_NATIONAL(TERRAKION),
+    SPECIES_TO_NATIONAL(VIRIZION),
+    SPECIES_TO_NATIONAL(TORNADUS),
+    SPECIES_TO_NATIONAL(THUNDURUS),
+    SPECIES_TO_NATIONAL(RESHIRAM),
+    SPECIES_TO_NATIONAL(ZEKROM),
+    SPECIES_TO_NATIONAL(LANDORUS),
+    SPECIES_TO_NATIONAL(KYUREM),
+    SPECIES_TO_NATIONAL(KELDEO),
+    SPECIES_TO_NATIONAL(MELOETTA),
+    SPECIES_TO_NATIONAL(GENESECT),
+    SPECIES_TO_NATIONAL(CHESPIN),
+    SPECIES_TO_NATIONAL(QUILLADIN),
+    SPECIES_TO_NATIONAL(CHESNAUGHT),
+    SPECIES_TO_NATIONAL(FENNEKIN),
+    SPECIES_TO_NATIONAL(BRAIXEN),
+    SPECIES_TO_NATIONAL(DELPHOX),
+    SPECIES_TO_NATIONAL(FROAKIE),
+    SPECIES_TO_NATIONAL(FROGADIER),
+    SPECIES_TO_NATIONAL(GRENINJA),
+    SPECIES_TO_NATIONAL(BUNNELBY),
+    SPECIES_TO_NATIONAL(DIGGERSBY),
+    SPECIES_TO_NATIONAL(FLETCHLING),
+    SPECIES_TO_NATIONAL(FLETCHINDER),
+    SPECIES_TO_NATIONAL(TALONFLAME),
+    SPECIES_TO_NATIONAL(SCATTERBUG),
+    SPECIES_TO_NATIONAL(SPEWPA),
+    SPECIES_TO_NATIONAL(VIVILLON),
+    SPECIES_TO_NATIONAL(LITLEO),
+    SPECIES_TO_NATIONAL(PYROAR),
+    SPECIES_TO_NATIONAL(FLABEBE),
+    SPECIES_TO_NATIONAL(FLOETTE),
+    SPECIES_TO_NATIONAL(FLORGES),
+    SPECIES_TO_NATIONAL(SKIDDO),
+    SPECIES_TO_NATIONAL(GOGOAT),
+    SPECIES_TO_NATIONAL(PANCHAM),
+    SPECIES_TO_NATIONAL(PANGORO),
+    SPECIES_TO_NATIONAL(FURFROU),
+    SPECIES_TO_NATIONAL(ESPURR),
+    SPECIES_TO_NATIONAL(MEOWSTIC),
+    SPECIES_TO_NATIONAL(HONEDGE),
+    SPECIES_TO_NATIONAL(DOUBLADE),
+    SPECIES_TO_NATIONAL(AEGISLASH),
+    SPECIES_TO_NATIONAL(SPRITZEE),
+    SPECIES_TO_NATIONAL(AROMATISSE),
+    SPECIES_TO_NATIONAL(SWIRLIX),
+    SPECIES_TO_NATIONAL(SLURPUFF),
+    SPECIES_TO_NATIONAL(INKAY),
+    SPECIES_TO_NATIONAL(MALAMAR),
+    SPECIES_TO_NATIONAL(BINACLE),
+    SPECIES_TO_NATIONAL(BARBARACLE),
+    SPECIES_TO_NATIONAL(SKRELP),
+    SPECIES_TO_NATIONAL(DRAGALGE),
+    SPECIES_TO_NATIONAL(CLAUNCHER),
+    SPECIES_TO_NATIONAL(CLAWITZER),
+    SPECIES_TO_NATIONAL(HELIOPTILE),
+    SPECIES_TO_NATIONAL(HELIOLISK),
+    SPECIES_TO_NATIONAL(TYRUNT),
+    SPECIES_TO_NATIONAL(TYRANTRUM),
+    SPECIES_TO_NATIONAL(AMAURA),
+    SPECIES_TO_NATIONAL(AURORUS),
+    SPECIES_TO_NATIONAL(SYLVEON),
+    SPECIES_TO_NATIONAL(HAWLUCHA),
+    SPECIES_TO_NATIONAL(DEDENNE),
+    SPECIES_TO_NATIONAL(CARBINK),
+    SPECIES_TO_NATIONAL(GOOMY),
+    SPECIES_TO_NATIONAL(SLIGGOO),
+    SPECIES_TO_NATIONAL(GOODRA),
+    SPECIES_TO_NATIONAL(KLEFKI),
+    SPECIES_TO_NATIONAL(PHANTUMP),
+    SPECIES_TO_NATIONAL(TREVENANT),
+    SPECIES_TO_NATIONAL(PUMPKABOO),
+    SPECIES_TO_NATIONAL(GOURGEIST),
+    SPECIES_TO_NATIONAL(BERGMITE),
+    SPECIES_TO_NATIONAL(AVALUGG),
+    SPECIES_TO_NATIONAL(NOIBAT),
+    SPECIES_TO_NATIONAL(NOIVERN),
+    SPECIES_TO_NATIONAL(XERNEAS),
+    SPECIES_TO_NATIONAL(YVELTAL),
+    SPECIES_TO_NATIONAL(ZYGARDE),
+    SPECIES_TO_NATIONAL(DIANCIE),
+    SPECIES_TO_NATIONAL(HOOPA),
+    SPECIES_TO_NATIONAL(VOLCANION),
+    SPECIES_TO_NATIONAL(ROWLET),
+    SPECIES_TO_NATIONAL(DARTRIX),
+    SPECIES_TO_NATIONAL(DECIDUEYE),
+    SPECIES_TO_NATIONAL(LITTEN),
+    SPECIES_TO_NATIONAL(TORRACAT),
+    SPECIES_TO_NATIONAL(INCINEROAR),
+    SPECIES_TO_NATIONAL(POPPLIO),
+    SPECIES_TO_NATIONAL(BRIONNE),
+    SPECIES_TO_NATIONAL(PRIMARINA),
+    SPECIES_TO_NATIONAL(PIKIPEK),
+    SPECIES_TO_NATIONAL(TRUMBEAK),
+    SPECIES_TO_NATIONAL(TOUCANNON),
+    SPECIES_TO_NATIONAL(YUNGOOS),
+    SPECIES_TO_NATIONAL(GUMSHOOS),
+    SPECIES_TO_NATIONAL(GRUBBIN),
+    SPECIES_TO_NATIONAL(CHARJABUG),
+    SPECIES_TO_NATIONAL(VIKAVOLT),
+    SPECIES_TO_NATIONAL(CRABRAWLER),
+    SPECIES_TO_NATIONAL(CRABOMINABLE),
+    SPECIES_TO_NATIONAL(ORICORIO),
+    SPECIES_TO_NATIONAL(CUTIEFLY),
+    SPECIES_TO_NATIONAL(RIBOMBEE),
+    SPECIES_TO_NATIONAL(ROCKRUFF),
+    SPECIES_TO_NATIONAL(LYCANROC),
+    SPECIES_TO_NATIONAL(WISHIWASHI),
+    SPECIES_TO_NATIONAL(MAREANIE),
+    SPECIES_TO_NATIONAL(TOXAPEX),
+    SPECIES_TO_NATIONAL(MUDBRAY),
+    SPECIES_TO_NATIONAL(MUDSDALE),
+    SPECIES_TO_NATIONAL(DEWPIDER),
+    SPECIES_TO_NATIONAL(ARAQUANID),
+    SPECIES_TO_NATIONAL(FOMANTIS),
+    SPECIES_TO_NATIONAL(LURANTIS),
+    SPECIES_TO_NATIONAL(MORELULL),
+    SPECIES_TO_NATIONAL(SHIINOTIC),
+    SPECIES_TO_NATIONAL(SALANDIT),
+    SPECIES_TO_NATIONAL(SALAZZLE),
+    SPECIES_TO_NATIONAL(STUFFUL),
+    SPECIES_TO_NATIONAL(BEWEAR),
+    SPECIES_TO_NATIONAL(BOUNSWEET),
+    SPECIES_TO_NATIONAL(STEENEE),
+    SPECIES_TO_NATIONAL(TSAREENA),
+    SPECIES_TO_NATIONAL(COMFEY),
+    SPECIES_TO_NATIONAL(ORANGURU),
+    SPECIES_TO_NATIONAL(PASSIMIAN),
+    SPECIES_TO_NATIONAL(WIMPOD),
+    SPECIES_TO_NATIONAL(GOLISOPOD),
+    SPECIES_TO_NATIONAL(SANDYGAST),
+    SPECIES_TO_NATIONAL(PALOSSAND),
+    SPECIES_TO_NATIONAL(PYUKUMUKU),
+    SPECIES_TO_NATIONAL(TYPE_NULL),
+    SPECIES_TO_NATIONAL(SILVALLY),
+    SPECIES_TO_NATIONAL(MINIOR),
+    SPECIES_TO_NATIONAL(KOMALA),
+    SPECIES_TO_NATIONAL(TURTONATOR),
+    SPECIES_TO_NATIONAL(TOGEDEMARU),
+    SPECIES_TO_NATIONAL(MIMIKYU),
+    SPECIES_TO_NATIONAL(BRUXISH),
+    SPECIES_TO_NATIONAL(DRAMPA),
+    SPECIES_TO_NATIONAL(DHELMISE),
+    SPECIES_TO_NATIONAL(JANGMO_O),
+    SPECIES_TO_NATIONAL(HAKAMO_O),
+    SPECIES_TO_NATIONAL(KOMMO_O),
+    SPECIES_TO_NATIONAL(TAPU_KOKO),
+    SPECIES_TO_NATIONAL(TAPU_LELE),
+    SPECIES_TO_NATIONAL(TAPU_BULU),
+    SPECIES_TO_NATIONAL(TAPU_FINI),
+    SPECIES_TO_NATIONAL(COSMOG),
+    SPECIES_TO_NATIONAL(COSMOEM),
+    SPECIES_TO_NATIONAL(SOLGALEO),
+    SPECIES_TO_NATIONAL(LUNALA),
+    SPECIES_TO_NATIONAL(NIHILEGO),
+    SPECIES_TO_NATIONAL(BUZZWOLE),
+    SPECIES_TO_NATIONAL(PHEROMOSA),
+    SPECIES_TO_NATIONAL(XURKITREE),
+    SPECIES_TO_NATIONAL(CELESTEELA),
+    SPECIES_TO_NATIONAL(KARTANA),
+    SPECIES_TO_NATIONAL(GUZZLORD),
+    SPECIES_TO_NATIONAL(NECROZMA),
+    SPECIES_TO_NATIONAL(MAGEARNA),
+    SPECIES_TO_NATIONAL(MARSHADOW),
+    SPECIES_TO_NATIONAL(POIPOLE),
+    SPECIES_TO_NATIONAL(NAGANADEL),
+    SPECIES_TO_NATIONAL(STAKATAKA),
+    SPECIES_TO_NATIONAL(BLACEPHALON),
+    SPECIES_TO_NATIONAL(ZERAORA),
+    SPECIES_TO_NATIONAL(MELTAN),
+    SPECIES_TO_NATIONAL(MELMETAL),
+    SPECIES_TO_NATIONAL(GROOKEY),
+    SPECIES_TO_NATIONAL(THWACKEY),
+    SPECIES_TO_NATIONAL(RILLABOOM),
+    SPECIES_TO_NATIONAL(SCORBUNNY),
+    SPECIES_TO_NATIONAL(RABOOT),
+    SPECIES_TO_NATIONAL(CINDERACE),
+    SPECIES_TO_NATIONAL(SOBBLE),
+    SPECIES_TO_NATIONAL(DRIZZILE),
+    SPECIES_TO_NATIONAL(INTELEON),
+    SPECIES_TO_NATIONAL(SKWOVET),
+    SPECIES_TO_NATIONAL(GREEDENT),
+    SPECIES_TO_NATIONAL(ROOKIDEE),
+    SPECIES_TO_NATIONAL(CORVISQUIRE),
+    SPECIES_TO_NATIONAL(CORVIKNIGHT),
+    SPECIES_TO_NATIONAL(BLIPBUG),
+    SPECIES_TO_NATIONAL(DOTTLER),
+    SPECIES_TO_NATIONAL(ORBEETLE),
+    SPECIES_TO_NATIONAL(NICKIT),
+    SPECIES_TO_NATIONAL(THIEVUL),
+    SPECIES_TO_NATIONAL(GOSSIFLEUR),
+    SPECIES_TO_NATIONAL(ELDEGOSS),
+    SPECIES_TO_NATIONAL(WOOLOO),
+    SPECIES_TO_NATIONAL(DUBWOOL),
+    SPECIES_TO_NATIONAL(CHEWTLE),
+    SPECIES_TO_NATIONAL(DREDNAW),
+    SPECIES_TO_NATIONAL(YAMPER),
+    SPECIES_TO_NATIONAL(BOLTUND),
+    SPECIES_TO_NATIONAL(ROLYCOLY),
+    SPECIES_TO_NATIONAL(CARKOL),
+    SPECIES_TO_NATIONAL(COALOSSAL),
+    SPECIES_TO_NATIONAL(APPLIN),
+    SPECIES_TO_NATIONAL(FLAPPLE),
+    SPECIES_TO_NATIONAL(APPLETUN),
+    SPECIES_TO_NATIONAL(SILICOBRA),
+    SPECIES_TO_NATIONAL(SANDACONDA),
+    SPECIES_TO_NATIONAL(CRAMORANT),
+    SPECIES_TO_NATIONAL(ARROKUDA),
+    SPECIES_TO_NATIONAL(BARRASKEWDA),
+    SPECIES_TO_NATIONAL(TOXEL),
+    SPECIES_TO_NATIONAL(TOXTRICITY),
+    SPECIES_TO_NATIONAL(SIZZLIPEDE),
+    SPECIES_TO_NATIONAL(CENTISKORCH),
+    SPECIES_TO_NATIONAL(CLOBBOPUS),
+    SPECIES_TO_NATIONAL(GRAPPLOCT),
+    SPECIES_TO_NATIONAL(SINISTEA),
+    SPECIES_TO_NATIONAL(POLTEAGEIST),
+    SPECIES_TO_NATIONAL(HATENNA),
+    SPECIES_TO_NATIONAL(HATTREM),
+    SPECIES_TO_NATIONAL(HATTERENE),
+    SPECIES_TO_NATIONAL(IMPIDIMP),
+    SPECIES_TO_NATIONAL(MORGREM),
+    SPECIES_TO_NATIONAL(GRIMMSNARL),
+    SPECIES_TO_NATIONAL(OBSTAGOON),
+    SPECIES_TO_NATIONAL(PERRSERKER),
+    SPECIES_TO_NATIONAL(CURSOLA),
+    SPECIES_TO_NATIONAL(SIRFETCHD),
+    SPECIES_TO_NATIONAL(MR_RIME),
+    SPECIES_TO_NATIONAL(RUNERIGUS),
+    SPECIES_TO_NATIONAL(MILCERY),
+    SPECIES_TO_NATIONAL(ALCREMIE),
+    SPECIES_TO_NATIONAL(FALINKS),
+    SPECIES_TO_NATIONAL(PINCURCHIN),
+    SPECIES_TO_NATIONAL(SNOM),
+    SPECIES_TO_NATIONAL(FROSMOTH),
+    SPECIES_TO_NATIONAL(STONJOURNER),
+    SPECIES_TO_NATIONAL(EISCUE),
+    SPECIES_TO_NATIONAL(INDEEDEE),
+    SPECIES_TO_NATIONAL(MORPEKO),
+    SPECIES_TO_NATIONAL(CUFANT),
+    SPECIES_TO_NATIONAL(COPPERAJAH),
+    SPECIES_TO_NATIONAL(DRACOZOLT),
+    SPECIES_TO_NATIONAL(ARCTOZOLT),
+    SPECIES_TO_NATIONAL(DRACOVISH),
+    SPECIES_TO_NATIONAL(ARCTOVISH),
+    SPECIES_TO_NATIONAL(DURALUDON),
+    SPECIES_TO_NATIONAL(DREEPY),
+    SPECIES_TO_NATIONAL(DRAKLOAK),
+    SPECIES_TO_NATIONAL(DRAGAPULT),
+    SPECIES_TO_NATIONAL(ZACIAN),
+    SPECIES_TO_NATIONAL(ZAMAZENTA),
+    SPECIES_TO_NATIONAL(ETERNATUS),
+    SPECIES_TO_NATIONAL(KUBFU),
+    SPECIES_TO_NATIONAL(URSHIFU),
+    SPECIES_TO_NATIONAL(ZARUDE),
+    SPECIES_TO_NATIONAL(REGIELEKI),
+    SPECIES_TO_NATIONAL(REGIDRAGO),
+    SPECIES_TO_NATIONAL(GLASTRIER),
+    SPECIES_TO_NATIONAL(SPECTRIER),
+    SPECIES_TO_NATIONAL(CALYREX),
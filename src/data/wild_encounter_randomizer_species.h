@@ -0,0 +1,793 @@
+// Every species GetRandomWildEncounterWithBST can pick from. Only read by tools/lookupgen,
+// which turns it into the BST-sorted table in wild_encounter_randomizer_table.h.
+static const u16 possibleWildEncounter[][1] =
+{
+    SPECIES_BULBASAUR,
+    SPECIES_IVYSAUR,
+    SPECIES_VENUSAUR,
+    SPECIES_CHARMANDER,
+    SPECIES_CHARMELEON,
+    SPECIES_CHARIZARD,
+    SPECIES_SQUIRTLE,
+    SPECIES_WARTORTLE,
+    SPECIES_BLASTOISE,
+    SPECIES_CATERPIE,
+    SPECIES_METAPOD,
+    SPECIES_BUTTERFREE,
+    SPECIES_WEEDLE,
+    SPECIES_KAKUNA,
+    SPECIES_BEEDRILL,
+    SPECIES_PIDGEY,
+    SPECIES_PIDGEOTTO,
+    SPECIES_PIDGEOT,
+    SPECIES_RATTATA,
+    SPECIES_RATTATA_ALOLAN,
+    SPECIES_RATICATE,
+    SPECIES_RATICATE_ALOLAN,
+    SPECIES_SPEAROW,
+    SPECIES_FEAROW,
+    SPECIES_EKANS,
+    SPECIES_ARBOK,
+    SPECIES_PIKACHU,
+    SPECIES_RAICHU,
+    SPECIES_RAICHU_ALOLAN,
+    SPECIES_SANDSHREW,
+    SPECIES_SANDSHREW_ALOLAN,
+    SPECIES_SANDSLASH,
+    SPECIES_SANDSLASH_ALOLAN,
+    SPECIES_NIDORAN_F,
+    SPECIES_NIDORINA,
+    SPECIES_NIDOQUEEN,
+    SPECIES_NIDORAN_M,
+    SPECIES_NIDORINO,
+    SPECIES_NIDOKING,
+    SPECIES_CLEFAIRY,
+    SPECIES_CLEFABLE,
+    SPECIES_VULPIX,
+    SPECIES_VULPIX_ALOLAN,
+    SPECIES_NINETALES,
+    SPECIES_NINETALES_ALOLAN,
+    SPECIES_JIGGLYPUFF,
+    SPECIES_WIGGLYTUFF,
+    SPECIES_ZUBAT,
+    SPECIES_GOLBAT,
+    SPECIES_ODDISH,
+    SPECIES_GLOOM,
+    SPECIES_VILEPLUME,
+    SPECIES_PARAS,
+    SPECIES_PARASECT,
+    SPECIES_VENONAT,
+    SPECIES_VENOMOTH,
+    SPECIES_DIGLETT,
+    SPECIES_DIGLETT_ALOLAN,
+    SPECIES_DUGTRIO,
+    SPECIES_DUGTRIO_ALOLAN,
+    SPECIES_MEOWTH,
+    SPECIES_MEOWTH_ALOLAN,
+    SPECIES_PERSIAN,
+    SPECIES_PERSIAN_ALOLAN,
+    SPECIES_PSYDUCK,
+    SPECIES_GOLDUCK,
+    SPECIES_MANKEY,
+    SPECIES_PRIMEAPE,
+    SPECIES_GROWLITHE,
+    SPECIES_ARCANINE,
+    SPECIES_POLIWAG,
+    SPECIES_POLIWHIRL,
+    SPECIES_POLIWRATH,
+    SPECIES_ABRA,
+    SPECIES_KADABRA,
+    SPECIES_ALAKAZAM,
+    SPECIES_MACHOP,
+    SPECIES_MACHOKE,
+    SPECIES_MACHAMP,
+    SPECIES_BELLSPROUT,
+    SPECIES_WEEPINBELL,
+    SPECIES_VICTREEBEL,
+    SPECIES_TENTACOOL,
+    SPECIES_TENTACRUEL,
+    SPECIES_GEODUDE,
+    SPECIES_GEODUDE_ALOLAN,
+    SPECIES_GRAVELER,
+    SPECIES_GRAVELER_ALOLAN,
+    SPECIES_GOLEM,
+    SPECIES_GOLEM_ALOLAN,
+    SPECIES_PONYTA,
+    SPECIES_RAPIDASH,
+    SPECIES_SLOWPOKE,
+    SPECIES_SLOWBRO,
+    SPECIES_MAGNEMITE,
+    SPECIES_MAGNETON,
+    SPECIES_FARFETCHD,
+    SPECIES_DODUO,
+    SPECIES_DODRIO,
+    SPECIES_SEEL,
+    SPECIES_DEWGONG,
+    SPECIES_GRIMER,
+    SPECIES_GRIMER_ALOLAN,
+    SPECIES_MUK,
+    SPECIES_MUK_ALOLAN,
+    SPECIES_SHELLDER,
+    SPECIES_CLOYSTER,
+    SPECIES_GASTLY,
+    SPECIES_HAUNTER,
+    SPECIES_GENGAR,
+    SPECIES_ONIX,
+    SPECIES_DROWZEE,
+    SPECIES_HYPNO,
+    SPECIES_KRABBY,
+    SPECIES_KINGLER,
+    SPECIES_VOLTORB,
+    SPECIES_ELECTRODE,
+    SPECIES_EXEGGCUTE,
+    SPECIES_EXEGGUTOR,
+    SPECIES_EXEGGUTOR_ALOLAN,
+    SPECIES_CUBONE,
+    SPECIES_MAROWAK,
+    SPECIES_MAROWAK_ALOLAN,
+    SPECIES_HITMONLEE,
+    SPECIES_HITMONCHAN,
+    SPECIES_LICKITUNG,
+    SPECIES_KOFFING,
+    SPECIES_WEEZING,
+    SPECIES_RHYHORN,
+    SPECIES_RHYDON,
+    SPECIES_CHANSEY,
+    SPECIES_TANGELA,
+    SPECIES_KANGASKHAN,
+    SPECIES_HORSEA,
+    SPECIES_SEADRA,
+    SPECIES_GOLDEEN,
+    SPECIES_SEAKING,
+    SPECIES_STARYU,
+    SPECIES_STARMIE,
+    SPECIES_MR_MIME,
+    SPECIES_SCYTHER,
+    SPECIES_JYNX,
+    SPECIES_ELECTABUZZ,
+    SPECIES_MAGMAR,
+    SPECIES_PINSIR,
+    SPECIES_TAUROS,
+    SPECIES_MAGIKARP,
+    SPECIES_GYARADOS,
+    SPECIES_LAPRAS,
+    SPECIES_DITTO,
+    SPECIES_EEVEE,
+    SPECIES_VAPOREON,
+    SPECIES_JOLTEON,
+    SPECIES_FLAREON,
+    SPECIES_PORYGON,
+    SPECIES_OMANYTE,
+    SPECIES_OMASTAR,
+    SPECIES_KABUTO,
+    SPECIES_KABUTOPS,
+    SPECIES_AERODACTYL,
+    SPECIES_SNORLAX,
+    SPECIES_ARTICUNO,
+    SPECIES_ZAPDOS,
+    SPECIES_MOLTRES,
+    SPECIES_DRATINI,
+    SPECIES_DRAGONAIR,
+    SPECIES_DRAGONITE,
+    SPECIES_MEWTWO,
+    SPECIES_MEW,
+    SPECIES_CHIKORITA,
+    SPECIES_BAYLEEF,
+    SPECIES_MEGANIUM,
+    SPECIES_CYNDAQUIL,
+    SPECIES_QUILAVA,
+    SPECIES_TYPHLOSION,
+    SPECIES_TOTODILE,
+    SPECIES_CROCONAW,
+    SPECIES_FERALIGATR,
+    SPECIES_SENTRET,
+    SPECIES_FURRET,
+    SPECIES_HOOTHOOT,
+    SPECIES_NOCTOWL,
+    SPECIES_LEDYBA,
+    SPECIES_LEDIAN,
+    SPECIES_SPINARAK,
+    SPECIES_ARIADOS,
+    SPECIES_CROBAT,
+    SPECIES_CHINCHOU,
+    SPECIES_LANTURN,
+    SPECIES_PICHU,
+    SPECIES_CLEFFA,
+    SPECIES_IGGLYBUFF,
+    SPECIES_TOGEPI,
+    SPECIES_TOGETIC,
+    SPECIES_NATU,
+    SPECIES_XATU,
+    SPECIES_MAREEP,
+    SPECIES_FLAAFFY,
+    SPECIES_AMPHAROS,
+    SPECIES_BELLOSSOM,
+    SPECIES_MARILL,
+    SPECIES_AZUMARILL,
+    SPECIES_SUDOWOODO,
+    SPECIES_POLITOED,
+    SPECIES_HOPPIP,
+    SPECIES_SKIPLOOM,
+    SPECIES_JUMPLUFF,
+    SPECIES_AIPOM,
+    SPECIES_SUNKERN,
+    SPECIES_SUNFLORA,
+    SPECIES_YANMA,
+    SPECIES_WOOPER,
+    SPECIES_QUAGSIRE,
+    SPECIES_ESPEON,
+    SPECIES_UMBREON,
+    SPECIES_MURKROW,
+    SPECIES_SLOWKING,
+    SPECIES_MISDREAVUS,
+    SPECIES_WOBBUFFET,
+    SPECIES_GIRAFARIG,
+    SPECIES_PINECO,
+    SPECIES_FORRETRESS,
+    SPECIES_DUNSPARCE,
+    SPECIES_GLIGAR,
+    SPECIES_STEELIX,
+    SPECIES_SNUBBULL,
+    SPECIES_GRANBULL,
+    SPECIES_QWILFISH,
+    SPECIES_SCIZOR,
+    SPECIES_SHUCKLE,
+    SPECIES_HERACROSS,
+    SPECIES_SNEASEL,
+    SPECIES_TEDDIURSA,
+    SPECIES_URSARING,
+    SPECIES_SLUGMA,
+    SPECIES_MAGCARGO,
+    SPECIES_SWINUB,
+    SPECIES_PILOSWINE,
+    SPECIES_CORSOLA,
+    SPECIES_REMORAID,
+    SPECIES_OCTILLERY,
+    SPECIES_DELIBIRD,
+    SPECIES_MANTINE,
+    SPECIES_SKARMORY,
+    SPECIES_HOUNDOUR,
+    SPECIES_HOUNDOOM,
+    SPECIES_KINGDRA,
+    SPECIES_PHANPY,
+    SPECIES_DONPHAN,
+    SPECIES_PORYGON2,
+    SPECIES_STANTLER,
+    SPECIES_SMEARGLE,
+    SPECIES_TYROGUE,
+    SPECIES_HITMONTOP,
+    SPECIES_SMOOCHUM,
+    SPECIES_ELEKID,
+    SPECIES_MAGBY,
+    SPECIES_MILTANK,
+    SPECIES_BLISSEY,
+    SPECIES_LARVITAR,
+    SPECIES_PUPITAR,
+    SPECIES_TYRANITAR,
+    SPECIES_LUGIA,
+    SPECIES_HO_OH,
+    SPECIES_TREECKO,
+    SPECIES_GROVYLE,
+    SPECIES_SCEPTILE,
+    SPECIES_TORCHIC,
+    SPECIES_COMBUSKEN,
+    SPECIES_BLAZIKEN,
+    SPECIES_MUDKIP,
+    SPECIES_MARSHTOMP,
+    SPECIES_SWAMPERT,
+    SPECIES_POOCHYENA,
+    SPECIES_MIGHTYENA,
+    SPECIES_ZIGZAGOON,
+    SPECIES_LINOONE,
+    SPECIES_WURMPLE,
+    SPECIES_SILCOON,
+    SPECIES_BEAUTIFLY,
+    SPECIES_CASCOON,
+    SPECIES_DUSTOX,
+    SPECIES_LOTAD,
+    SPECIES_LOMBRE,
+    SPECIES_LUDICOLO,
+    SPECIES_SEEDOT,
+    SPECIES_NUZLEAF,
+    SPECIES_SHIFTRY,
+    SPECIES_TAILLOW,
+    SPECIES_SWELLOW,
+    SPECIES_WINGULL,
+    SPECIES_PELIPPER,
+    SPECIES_RALTS,
+    SPECIES_KIRLIA,
+    SPECIES_GARDEVOIR,
+    SPECIES_SURSKIT,
+    SPECIES_MASQUERAIN,
+    SPECIES_SHROOMISH,
+    SPECIES_BRELOOM,
+    SPECIES_SLAKOTH,
+    SPECIES_VIGOROTH,
+    SPECIES_SLAKING,
+    SPECIES_NINCADA,
+    SPECIES_NINJASK,
+    SPECIES_SHEDINJA,
+    SPECIES_WHISMUR,
+    SPECIES_LOUDRED,
+    SPECIES_EXPLOUD,
+    SPECIES_MAKUHITA,
+    SPECIES_HARIYAMA,
+    SPECIES_AZURILL,
+    SPECIES_NOSEPASS,
+    SPECIES_SKITTY,
+    SPECIES_DELCATTY,
+    SPECIES_SABLEYE,
+    SPECIES_MAWILE,
+    SPECIES_ARON,
+    SPECIES_LAIRON,
+    SPECIES_AGGRON,
+    SPECIES_MEDITITE,
+    SPECIES_MEDICHAM,
+    SPECIES_ELECTRIKE,
+    SPECIES_MANECTRIC,
+    SPECIES_PLUSLE,
+    SPECIES_MINUN,
+    SPECIES_VOLBEAT,
+    SPECIES_ILLUMISE,
+    SPECIES_ROSELIA,
+    SPECIES_GULPIN,
+    SPECIES_SWALOT,
+    SPECIES_CARVANHA,
+    SPECIES_SHARPEDO,
+    SPECIES_WAILMER,
+    SPECIES_WAILORD,
+    SPECIES_NUMEL,
+    SPECIES_CAMERUPT,
+    SPECIES_TORKOAL,
+    SPECIES_SPOINK,
+    SPECIES_GRUMPIG,
+    SPECIES_SPINDA,
+    SPECIES_TRAPINCH,
+    SPECIES_VIBRAVA,
+    SPECIES_FLYGON,
+    SPECIES_CACNEA,
+    SPECIES_CACTURNE,
+    SPECIES_SWABLU,
+    SPECIES_ALTARIA,
+    SPECIES_ZANGOOSE,
+    SPECIES_SEVIPER,
+    SPECIES_LUNATONE,
+    SPECIES_SOLROCK,
+    SPECIES_BARBOACH,
+    SPECIES_WHISCASH,
+    SPECIES_CORPHISH,
+    SPECIES_CRAWDAUNT,
+    SPECIES_BALTOY,
+    SPECIES_CLAYDOL,
+    SPECIES_LILEEP,
+    SPECIES_CRADILY,
+    SPECIES_ANORITH,
+    SPECIES_ARMALDO,
+    SPECIES_FEEBAS,
+    SPECIES_MILOTIC,
+    SPECIES_CASTFORM,
+    SPECIES_KECLEON,
+    SPECIES_SHUPPET,
+    SPECIES_BANETTE,
+    SPECIES_DUSKULL,
+    SPECIES_DUSCLOPS,
+    SPECIES_TROPIUS,
+    SPECIES_CHIMECHO,
+    SPECIES_ABSOL,
+    SPECIES_WYNAUT,
+    SPECIES_SNORUNT,
+    SPECIES_GLALIE,
+    SPECIES_SPHEAL,
+    SPECIES_SEALEO,
+    SPECIES_WALREIN,
+    SPECIES_CLAMPERL,
+    SPECIES_HUNTAIL,
+    SPECIES_GOREBYSS,
+    SPECIES_RELICANTH,
+    SPECIES_LUVDISC,
+    SPECIES_BAGON,
+    SPECIES_SHELGON,
+    SPECIES_SALAMENCE,
+    SPECIES_BELDUM,
+    SPECIES_METANG,
+    SPECIES_METAGROSS,
+    SPECIES_REGIROCK,
+    SPECIES_REGICE,
+    SPECIES_REGISTEEL,
+    SPECIES_LATIAS,
+    SPECIES_LATIOS,
+    SPECIES_KYOGRE,
+    SPECIES_GROUDON,
+    SPECIES_RAYQUAZA,
+    SPECIES_JIRACHI,
+    SPECIES_DEOXYS,
+    SPECIES_TURTWIG,
+    SPECIES_GROTLE,
+    SPECIES_TORTERRA,
+    SPECIES_CHIMCHAR,
+    SPECIES_MONFERNO,
+    SPECIES_INFERNAPE,
+    SPECIES_PIPLUP,
+    SPECIES_PRINPLUP,
+    SPECIES_EMPOLEON,
+    SPECIES_STARLY,
+    SPECIES_STARAVIA,
+    SPECIES_STARAPTOR,
+    SPECIES_BIDOOF,
+    SPECIES_BIBAREL,
+    SPECIES_KRICKETOT,
+    SPECIES_KRICKETUNE,
+    SPECIES_SHINX,
+    SPECIES_LUXIO,
+    SPECIES_LUXRAY,
+    SPECIES_BUDEW,
+    SPECIES_ROSERADE,
+    SPECIES_CRANIDOS,
+    SPECIES_RAMPARDOS,
+    SPECIES_SHIELDON,
+    SPECIES_BASTIODON,
+    SPECIES_BURMY,
+    SPECIES_WORMADAM,
+    SPECIES_WORMADAM_SANDY_CLOAK,
+    SPECIES_WORMADAM_TRASH_CLOAK,
+    SPECIES_MOTHIM,
+    SPECIES_COMBEE,
+    SPECIES_VESPIQUEN,
+    SPECIES_PACHIRISU,
+    SPECIES_BUIZEL,
+    SPECIES_FLOATZEL,
+    SPECIES_CHERUBI,
+    SPECIES_CHERRIM,
+    SPECIES_SHELLOS,
+    SPECIES_GASTRODON,
+    SPECIES_AMBIPOM,
+    SPECIES_DRIFLOON,
+    SPECIES_DRIFBLIM,
+    SPECIES_BUNEARY,
+    SPECIES_LOPUNNY,
+    SPECIES_MISMAGIUS,
+    SPECIES_HONCHKROW,
+    SPECIES_GLAMEOW,
+    SPECIES_PURUGLY,
+    SPECIES_CHINGLING,
+    SPECIES_STUNKY,
+    SPECIES_SKUNTANK,
+    SPECIES_BRONZOR,
+    SPECIES_BRONZONG,
+    SPECIES_BONSLY,
+    SPECIES_MIME_JR,
+    SPECIES_HAPPINY,
+    SPECIES_CHATOT,
+    SPECIES_SPIRITOMB,
+    SPECIES_GIBLE,
+    SPECIES_GABITE,
+    SPECIES_GARCHOMP,
+    SPECIES_MUNCHLAX,
+    SPECIES_RIOLU,
+    SPECIES_LUCARIO,
+    SPECIES_HIPPOPOTAS,
+    SPECIES_HIPPOWDON,
+    SPECIES_SKORUPI,
+    SPECIES_DRAPION,
+    SPECIES_CROAGUNK,
+    SPECIES_TOXICROAK,
+    SPECIES_CARNIVINE,
+    SPECIES_FINNEON,
+    SPECIES_LUMINEON,
+    SPECIES_MANTYKE,
+    SPECIES_SNOVER,
+    SPECIES_ABOMASNOW,
+    SPECIES_WEAVILE,
+    SPECIES_MAGNEZONE,
+    SPECIES_LICKILICKY,
+    SPECIES_RHYPERIOR,
+    SPECIES_TANGROWTH,
+    SPECIES_ELECTIVIRE,
+    SPECIES_MAGMORTAR,
+    SPECIES_TOGEKISS,
+    SPECIES_YANMEGA,
+    SPECIES_LEAFEON,
+    SPECIES_GLACEON,
+    SPECIES_GLISCOR,
+    SPECIES_MAMOSWINE,
+    SPECIES_PORYGON_Z,
+    SPECIES_GALLADE,
+    SPECIES_PROBOPASS,
+    SPECIES_DUSKNOIR,
+    SPECIES_FROSLASS,
+    SPECIES_ROTOM,
+    SPECIES_HEATRAN,
+    SPECIES_REGIGIGAS,
+    SPECIES_SNIVY,
+    SPECIES_SERVINE,
+    SPECIES_SERPERIOR,
+    SPECIES_TEPIG,
+    SPECIES_PIGNITE,
+    SPECIES_EMBOAR,
+    SPECIES_OSHAWOTT,
+    SPECIES_DEWOTT,
+    SPECIES_SAMUROTT,
+    SPECIES_PATRAT,
+    SPECIES_WATCHOG,
+    SPECIES_LILLIPUP,
+    SPECIES_HERDIER,
+    SPECIES_STOUTLAND,
+    SPECIES_PURRLOIN,
+    SPECIES_LIEPARD,
+    SPECIES_PANSAGE,
+    SPECIES_SIMISAGE,
+    SPECIES_PANSEAR,
+    SPECIES_SIMISEAR,
+    SPECIES_PANPOUR,
+    SPECIES_SIMIPOUR,
+    SPECIES_MUNNA,
+    SPECIES_MUSHARNA,
+    SPECIES_PIDOVE,
+    SPECIES_TRANQUILL,
+    SPECIES_UNFEZANT,
+    SPECIES_BLITZLE,
+    SPECIES_ZEBSTRIKA,
+    SPECIES_ROGGENROLA,
+    SPECIES_BOLDORE,
+    SPECIES_GIGALITH,
+    SPECIES_WOOBAT,
+    SPECIES_SWOOBAT,
+    SPECIES_DRILBUR,
+    SPECIES_EXCADRILL,
+    SPECIES_AUDINO,
+    SPECIES_TIMBURR,
+    SPECIES_GURDURR,
+    SPECIES_CONKELDURR,
+    SPECIES_TYMPOLE,
+    SPECIES_PALPITOAD,
+    SPECIES_SEISMITOAD,
+    SPECIES_THROH,
+    SPECIES_SAWK,
+    SPECIES_SEWADDLE,
+    SPECIES_SWADLOON,
+    SPECIES_LEAVANNY,
+    SPECIES_VENIPEDE,
+    SPECIES_WHIRLIPEDE,
+    SPECIES_SCOLIPEDE,
+    SPECIES_COTTONEE,
+    SPECIES_WHIMSICOTT,
+    SPECIES_PETILIL,
+    SPECIES_LILLIGANT,
+    SPECIES_BASCULIN,
+    SPECIES_SANDILE,
+    SPECIES_KROKOROK,
+    SPECIES_KROOKODILE,
+    SPECIES_DARUMAKA,
+    SPECIES_DARMANITAN,
+    SPECIES_MARACTUS,
+    SPECIES_DWEBBLE,
+    SPECIES_CRUSTLE,
+    SPECIES_SCRAGGY,
+    SPECIES_SCRAFTY,
+    SPECIES_SIGILYPH,
+    SPECIES_YAMASK,
+    SPECIES_COFAGRIGUS,
+    SPECIES_TIRTOUGA,
+    SPECIES_CARRACOSTA,
+    SPECIES_ARCHEN,
+    SPECIES_ARCHEOPS,
+    SPECIES_TRUBBISH,
+    SPECIES_GARBODOR,
+    SPECIES_ZORUA,
+    SPECIES_ZOROARK,
+    SPECIES_MINCCINO,
+    SPECIES_CINCCINO,
+    SPECIES_GOTHITA,
+    SPECIES_GOTHORITA,
+    SPECIES_GOTHITELLE,
+    SPECIES_SOLOSIS,
+    SPECIES_DUOSION,
+    SPECIES_REUNICLUS,
+    SPECIES_DUCKLETT,
+    SPECIES_SWANNA,
+    SPECIES_VANILLITE,
+    SPECIES_VANILLISH,
+    SPECIES_VANILLUXE,
+    SPECIES_DEERLING,
+    SPECIES_SAWSBUCK,
+    SPECIES_EMOLGA,
+    SPECIES_KARRABLAST,
+    SPECIES_ESCAVALIER,
+    SPECIES_FOONGUS,
+    SPECIES_AMOONGUSS,
+    SPECIES_FRILLISH,
+    SPECIES_JELLICENT,
+    SPECIES_ALOMOMOLA,
+    SPECIES_JOLTIK,
+    SPECIES_GALVANTULA,
+    SPECIES_FERROSEED,
+    SPECIES_FERROTHORN,
+    SPECIES_KLINK,
+    SPECIES_KLANG,
+    SPECIES_KLINKLANG,
+    SPECIES_TYNAMO,
+    SPECIES_EELEKTRIK,
+    SPECIES_EELEKTROSS,
+    SPECIES_ELGYEM,
+    SPECIES_BEHEEYEM,
+    SPECIES_LITWICK,
+    SPECIES_LAMPENT,
+    SPECIES_CHANDELURE,
+    SPECIES_AXEW,
+    SPECIES_FRAXURE,
+    SPECIES_HAXORUS,
+    SPECIES_CUBCHOO,
+    SPECIES_BEARTIC,
+    SPECIES_CRYOGONAL,
+    SPECIES_SHELMET,
+    SPECIES_ACCELGOR,
+    SPECIES_STUNFISK,
+    SPECIES_MIENFOO,
+    SPECIES_MIENSHAO,
+    SPECIES_DRUDDIGON,
+    SPECIES_GOLETT,
+    SPECIES_GOLURK,
+    SPECIES_PAWNIARD,
+    SPECIES_BISHARP,
+    SPECIES_BOUFFALANT,
+    SPECIES_RUFFLET,
+    SPECIES_BRAVIARY,
+    SPECIES_VULLABY,
+    SPECIES_MANDIBUZZ,
+    SPECIES_HEATMOR,
+    SPECIES_DURANT,
+    SPECIES_DEINO,
+    SPECIES_ZWEILOUS,
+    SPECIES_HYDREIGON,
+    SPECIES_LARVESTA,
+    SPECIES_VOLCARONA,
+    SPECIES_MELOETTA,
+    SPECIES_CHESPIN,
+    SPECIES_QUILLADIN,
+    SPECIES_CHESNAUGHT,
+    SPECIES_FENNEKIN,
+    SPECIES_BRAIXEN,
+    SPECIES_DELPHOX,
+    SPECIES_FROAKIE,
+    SPECIES_FROGADIER,
+    SPECIES_GRENINJA,
+    SPECIES_BUNNELBY,
+    SPECIES_DIGGERSBY,
+    SPECIES_FLETCHLING,
+    SPECIES_FLETCHINDER,
+    SPECIES_TALONFLAME,
+    SPECIES_SCATTERBUG,
+    SPECIES_SPEWPA,
+    SPECIES_VIVILLON,
+    SPECIES_VIVILLON_POKE_BALL,
+    SPECIES_LITLEO,
+    SPECIES_PYROAR,
+    SPECIES_FLABEBE,
+    SPECIES_FLOETTE,
+    SPECIES_FLORGES,
+    SPECIES_SKIDDO,
+    SPECIES_GOGOAT,
+    SPECIES_PANCHAM,
+    SPECIES_PANGORO,
+    SPECIES_FURFROU,
+    SPECIES_ESPURR,
+    SPECIES_MEOWSTIC,
+    SPECIES_MEOWSTIC_FEMALE,
+    SPECIES_HONEDGE,
+    SPECIES_DOUBLADE,
+    SPECIES_AEGISLASH,
+    SPECIES_SPRITZEE,
+    SPECIES_AROMATISSE,
+    SPECIES_SWIRLIX,
+    SPECIES_SLURPUFF,
+    SPECIES_INKAY,
+    SPECIES_MALAMAR,
+    SPECIES_BINACLE,
+    SPECIES_BARBARACLE,
+    SPECIES_SKRELP,
+    SPECIES_DRAGALGE,
+    SPECIES_CLAUNCHER,
+    SPECIES_CLAWITZER,
+    SPECIES_HELIOPTILE,
+    SPECIES_HELIOLISK,
+    SPECIES_TYRUNT,
+    SPECIES_TYRANTRUM,
+    SPECIES_AMAURA,
+    SPECIES_AURORUS,
+    SPECIES_SYLVEON,
+    SPECIES_HAWLUCHA,
+    SPECIES_DEDENNE,
+    SPECIES_CARBINK,
+    SPECIES_GOOMY,
+    SPECIES_SLIGGOO,
+    SPECIES_GOODRA,
+    SPECIES_KLEFKI,
+    SPECIES_PHANTUMP,
+    SPECIES_TREVENANT,
+    SPECIES_PUMPKABOO,
+    SPECIES_PUMPKABOO_SMALL,
+    SPECIES_PUMPKABOO_LARGE,
+    SPECIES_PUMPKABOO_SUPER,
+    SPECIES_GOURGEIST,
+    SPECIES_GOURGEIST_SMALL,
+    SPECIES_GOURGEIST_LARGE,
+    SPECIES_GOURGEIST_SUPER,
+    SPECIES_BERGMITE,
+    SPECIES_AVALUGG,
+    SPECIES_NOIBAT,
+    SPECIES_NOIVERN,
+    SPECIES_DIANCIE,
+    SPECIES_ROWLET,
+    SPECIES_DARTRIX,
+    SPECIES_DECIDUEYE,
+    SPECIES_LITTEN,
+    SPECIES_TORRACAT,
+    SPECIES_INCINEROAR,
+    SPECIES_POPPLIO,
+    SPECIES_BRIONNE,
+    SPECIES_PRIMARINA,
+    SPECIES_PIKIPEK,
+    SPECIES_TRUMBEAK,
+    SPECIES_TOUCANNON,
+    SPECIES_YUNGOOS,
+    SPECIES_GUMSHOOS,
+    SPECIES_GRUBBIN,
+    SPECIES_CHARJABUG,
+    SPECIES_VIKAVOLT,
+    SPECIES_CRABRAWLER,
+    SPECIES_CRABOMINABLE,
+    SPECIES_ORICORIO,
+    SPECIES_ORICORIO_POM_POM,
+    SPECIES_ORICORIO_PAU,
+    SPECIES_ORICORIO_SENSU,
+    SPECIES_CUTIEFLY,
+    SPECIES_RIBOMBEE,
+    SPECIES_ROCKRUFF,
+    SPECIES_LYCANROC,
+    SPECIES_LYCANROC_MIDNIGHT,
+    SPECIES_LYCANROC_DUSK,
+    SPECIES_WISHIWASHI,
+    SPECIES_MAREANIE,
+    SPECIES_TOXAPEX,
+    SPECIES_MUDBRAY,
+    SPECIES_MUDSDALE,
+    SPECIES_DEWPIDER,
+    SPECIES_ARAQUANID,
+    SPECIES_FOMANTIS,
+    SPECIES_LURANTIS,
+    SPECIES_MORELULL,
+    SPECIES_SHIINOTIC,
+    SPECIES_SALANDIT,
+    SPECIES_SALAZZLE,
+    SPECIES_STUFFUL,
+    SPECIES_BEWEAR,
+    SPECIES_BOUNSWEET,
+    SPECIES_STEENEE,
+    SPECIES_TSAREENA,
+    SPECIES_COMFEY,
+    SPECIES_ORANGURU,
+    SPECIES_PASSIMIAN,
+    SPECIES_WIMPOD,
+    SPECIES_GOLISOPOD,
+    SPECIES_SANDYGAST,
+    SPECIES_PALOSSAND,
+    SPECIES_PYUKUMUKU,
+    SPECIES_MINIOR,
+    SPECIES_KOMALA,
+    SPECIES_TURTONATOR,
+    SPECIES_TOGEDEMARU,
+    SPECIES_MIMIKYU,
+    SPECIES_BRUXISH,
+    SPECIES_DRAMPA,
+    SPECIES_DHELMISE,
+    SPECIES_JANGMO_O,
+    SPECIES_HAKAMO_O,
+    SPECIES_KOMMO_O,
+    SPECIES_COSMOG,
+    SPECIES_COSMOEM,
+    SPECIES_SOLGALEO,
+    SPECIES_LUNALA,
+    SPECIES_MAGEARNA,
+    SPECIES_MELTAN,
+    SPECIES_MELMETAL
+};
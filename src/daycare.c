@@ -39,11 +39,10 @@ EWRAM_DATA static u16 sHatchedEggLevelUpMoves[EGG_LVL_UP_MOVES_ARRAY_COUNT] = {0
 EWRAM_DATA static u16 sHatchedEggFatherMoves[MAX_MON_MOVES] = {0};
 EWRAM_DATA static u16 sHatchedEggFinalMoves[MAX_MON_MOVES] = {0};
 EWRAM_DATA static u16 sHatchedEggEggMoves[EGG_MOVES_ARRAY_COUNT] = {0};
-EWRAM_DATA static u16 sTransferEggMovesZero[EGG_MOVES_ARRAY_COUNT] = {0};
-EWRAM_DATA static u16 sTransferEggMovesOne[EGG_MOVES_ARRAY_COUNT] = {0};
 EWRAM_DATA static u16 sHatchedEggMotherMoves[MAX_MON_MOVES] = {0};
 
 #include "data/pokemon/egg_moves.h"
+#include "data/pokemon/egg_moves_index.h"
 
 static const struct WindowTemplate sDaycareLevelMenuWindowTemplate =
 {
@@ -401,35 +400,7 @@ static void ClearAllDaycareData(struct DayCare *daycare)
 // given species.
 static u16 GetEggSpecies(u16 species)
 {
-    int i, j, k;
-    bool8 found;
-
-    // Working backwards up to 5 times seems arbitrary, since the maximum number
-    // of times would only be 3 for 3-stage evolutions.
-    for (i = 0; i < EVOS_PER_MON; i++)
-    { 
-        found = FALSE;
-        for (j = 1; j < NUM_SPECIES; j++)
-        {
-            for (k = 0; k < EVOS_PER_MON; k++)
-            {
-                if (gEvolutionTable[j][k].targetSpecies == species)
-                {
-                    species = j;
-                    found = TRUE;
-                    break;
-                }
-            }
-
-            if (found)
-                break;
-        }
-
-        if (j == NUM_SPECIES)
-            break;
-    }
-
-    return species;
+    return GetEvolutionFamilyRoot(species);
 }
 
 static s32 GetParentToInheritNature(struct DayCare *daycare)
@@ -659,83 +630,36 @@ static void InheritIVs(struct Pokemon *egg, struct DayCare *daycare)
 // the given array.
 static u8 GetEggMoves(u16 species, u16 *eggMoves)
 {
-    u16 eggMoveIdx;
-    u16 numEggMoves;
-    u16 i;
-
-    numEggMoves = 0;
-    eggMoveIdx = 0;
-    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
-    {
-        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
-        {
-            eggMoveIdx = i + 1;
-            break;
-        }
-    }
+    const u16 *moves;
+    u8 numEggMoves;
+    u8 i;
 
-    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
-    {
-        if (gEggMoves[eggMoveIdx + i] > EGG_MOVES_SPECIES_OFFSET)
-            break;
+    if (species >= NUM_SPECIES)
+        return 0;
 
-        eggMoves[i] = gEggMoves[eggMoveIdx + i];
-        numEggMoves++;
-    }
+    moves = &gEggMoves[sEggMovesIndex[species].offset];
+    numEggMoves = sEggMovesIndex[species].count;
+    for (i = 0; i < numEggMoves; i++)
+        eggMoves[i] = moves[i];
 
     return numEggMoves;
 }
 u8 GetEggMovesSpecies(u16 species, u16 *eggMoves)
 {
-    u16 eggMoveIdx;
-    u16 numEggMoves;
-    u16 i;
-
-    numEggMoves = 0;
-    eggMoveIdx = 0;
-    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
-    {
-        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
-        {
-            eggMoveIdx = i + 1;
-            break;
-        }
-    }
-
-    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
-    {
-        if (gEggMoves[eggMoveIdx + i] > EGG_MOVES_SPECIES_OFFSET)
-        {
-            // TODO: the curly braces around this if statement are required for a matching build.
-            break;
-        }
-
-        eggMoves[i] = gEggMoves[eggMoveIdx + i];
-        numEggMoves++;
-    }
-
-    return numEggMoves;
+    return GetEggMoves(species, eggMoves);
 }
 bool8 SpeciesCanLearnEggMove(u16 species, u16 move) //Move search PokedexPlus HGSS_Ui
 {
-    u16 eggMoveIdx;
-    u16 i;
-    eggMoveIdx = 0;
-    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
-    {
-        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
-        {
-            eggMoveIdx = i + 1;
-            break;
-        }
-    }
+    const u16 *moves;
+    u8 i;
 
-    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
-    {
-        if (gEggMoves[eggMoveIdx + i] > EGG_MOVES_SPECIES_OFFSET)
-            return FALSE;
+    if (species >= NUM_SPECIES)
+        return FALSE;
 
-        if (move == gEggMoves[eggMoveIdx + i])
+    moves = &gEggMoves[sEggMovesIndex[species].offset];
+    for (i = 0; i < sEggMovesIndex[species].count; i++)
+    {
+        if (move == moves[i])
             return TRUE;
     }
     return FALSE;
@@ -743,42 +667,13 @@ bool8 SpeciesCanLearnEggMove(u16 species, u16 move) //Move search PokedexPlus HG
 
 static u8 GetBoxMonEggMoves(struct BoxPokemon *boxMon, u16 *eggMoves)
 {
-    u16 eggMoveIdx;
-    u16 numEggMoves;
-    u16 species;
-    u16 i;
-
-    numEggMoves = 0;
-    eggMoveIdx = 0;
-    species = GetBoxMonData(boxMon, MON_DATA_SPECIES);
-    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
-    {
-        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
-        {
-            eggMoveIdx = i + 1;
-            break;
-        }
-    }
-
-    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
-    {
-        if (gEggMoves[eggMoveIdx + i] > EGG_MOVES_SPECIES_OFFSET)
-        {
-            break;
-        }
-
-        eggMoves[i] = gEggMoves[eggMoveIdx + i];
-        numEggMoves++;
-    }
-
-    return numEggMoves;
+    return GetEggMoves(GetBoxMonData(boxMon, MON_DATA_SPECIES), eggMoves);
 }
 
 static void TransferEggMoves (struct DayCare *daycare)
 {
-    u16 numEggMovesZero, numEggMovesOne;
     u16 baseSpeciesSlotZero, baseSpeciesSlotOne;
-    u16 i, j;
+    u16 i;
 
     // Clear and/or populate arrays
     for (i = 0; i < MAX_MON_MOVES; i++)
@@ -786,11 +681,6 @@ static void TransferEggMoves (struct DayCare *daycare)
         sHatchedEggMotherMoves[i] = MOVE_NONE; 
         sHatchedEggFatherMoves[i] = MOVE_NONE;
     }
-    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
-    {
-        sTransferEggMovesZero[i] = MOVE_NONE;
-        sTransferEggMovesOne[i] = MOVE_NONE;
-    }
     for (i = 0; i < MAX_MON_MOVES; i++)
     {
         sHatchedEggFatherMoves[i] = GetBoxMonData(&daycare->mons[0].mon, MON_DATA_MOVE1 + i); // Treat father as slot 0
@@ -801,22 +691,13 @@ static void TransferEggMoves (struct DayCare *daycare)
     baseSpeciesSlotZero = GetEggSpecies(GetBoxMonData(&daycare->mons[0].mon, MON_DATA_SPECIES));
     baseSpeciesSlotOne = GetEggSpecies(GetBoxMonData(&daycare->mons[1].mon, MON_DATA_SPECIES));
 
-    numEggMovesZero = GetEggMoves(baseSpeciesSlotZero, sTransferEggMovesZero);
-    numEggMovesOne = GetEggMoves(baseSpeciesSlotOne, sTransferEggMovesOne);
-
     // Get egg moves from slot 0 mon ("father"), give to slot 1 mon if it has space
     for (i = 0; i < MAX_MON_MOVES; i++)
     {
         if (sHatchedEggFatherMoves[i] != MOVE_NONE)
         {
-            for (j = 0; j < numEggMovesOne; j++)
-            {
-                if (sHatchedEggFatherMoves[i] == sTransferEggMovesOne[j])
-                {
-                    GiveMoveToBoxMon(&daycare->mons[1].mon, sHatchedEggFatherMoves[i]);
-                    break;
-                }
-            }
+            if (SpeciesCanLearnEggMove(baseSpeciesSlotOne, sHatchedEggFatherMoves[i]))
+                GiveMoveToBoxMon(&daycare->mons[1].mon, sHatchedEggFatherMoves[i]);
         }
         else
         {
@@ -829,14 +710,8 @@ static void TransferEggMoves (struct DayCare *daycare)
     {
         if (sHatchedEggMotherMoves[i] != MOVE_NONE)
         {
-            for (j = 0; j < numEggMovesZero; j++)
-            {
-                if (sHatchedEggMotherMoves[i] == sTransferEggMovesZero[j])
-                {
-                    GiveMoveToBoxMon(&daycare->mons[0].mon, sHatchedEggMotherMoves[i]);
-                    break;
-                }
-            }
+            if (SpeciesCanLearnEggMove(baseSpeciesSlotZero, sHatchedEggMotherMoves[i]))
+                GiveMoveToBoxMon(&daycare->mons[0].mon, sHatchedEggMotherMoves[i]);
         }
         else
         {
@@ -1,6 +1,7 @@
 #include "global.h"
 #include "event_data.h"
 #include "pokedex.h"
+#include "event_object_movement.h"
 
 #define NUM_SPECIAL_FLAGS (SPECIAL_FLAGS_END - SPECIAL_FLAGS_START + 1)
 #define NUM_TEMP_FLAGS    (TEMP_FLAGS_END - TEMP_FLAGS_START + 1)
@@ -219,8 +220,11 @@ u8 FlagSet(u16 id)
 u8 FlagClear(u16 id)
 {
     u8 *ptr = GetFlagPointer(id);
-    if (ptr)
+    if (ptr && (*ptr & (1 << (id & 7))))
+    {
         *ptr &= ~(1 << (id & 7));
+        RetryObjectEventSpawnsForFlag(id);
+    }
     return 0;
 }
 
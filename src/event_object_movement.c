@@ -66,6 +66,33 @@ static EWRAM_DATA u8 sCurrentReflectionType = 0;
 static EWRAM_DATA u16 sCurrentSpecialObjectPaletteTag = 0;
 static EWRAM_DATA struct LockedAnimObjectEvents *sLockedAnimObjectEvents = {0};
 
+// Coords are hashed into an 8x8 grid of cells, each holding a mask of the object events
+// whose current or previous coords fall in it. Cells alias and may keep the bits of
+// inactive objects, so lookups still check every candidate exactly; the grid only
+// guarantees that an object is never missing from the cells of its own coords.
+#define OCCUPANCY_CELL(x, y) (((x) & 7) | (((y) & 7) << 3))
+#define OCCUPANCY_CELL_COUNT 64
+
+static EWRAM_DATA u16 sObjectEventOccupancy[OCCUPANCY_CELL_COUNT] = {0};
+static EWRAM_DATA u8 sObjectEventOccupiedCells[OBJECT_EVENTS_COUNT][2] = {0};
+
+// Template ids sorted by x and by y, built by the full spawn sweep when a map's objects
+// are set up, so a camera step only checks the templates in the newly revealed strip.
+// Anything that moves a template must call InvalidateObjectEventSpawnIndex.
+// retrySweep makes the next camera step do a full sweep again. It is set when an in-view
+// template could not be spawned because every object event or sprite was in use, and when
+// a template's flag is cleared, as the template may already be in view.
+struct ObjectEventSpawnIndex
+{
+    u8 byX[OBJECT_EVENT_TEMPLATES_COUNT];
+    u8 byY[OBJECT_EVENT_TEMPLATES_COUNT];
+    u8 count;
+    bool8 valid;
+    bool8 retrySweep;
+};
+
+static EWRAM_DATA struct ObjectEventSpawnIndex sObjectEventSpawnIndex = {0};
+
 static void MoveCoordsInDirection(u32, s16 *, s16 *, s16, s16);
 static bool8 ObjectEventExecSingleMovementAction(struct ObjectEvent *, struct Sprite *);
 static void SetMovementDelay(struct Sprite *, s16);
@@ -77,7 +104,10 @@ static void ObjectEventExecHeldMovementAction(struct ObjectEvent *, struct Sprit
 static void UpdateObjectEventSpriteAnimPause(struct ObjectEvent *, struct Sprite *);
 static bool8 IsCoordOutsideObjectEventMovementRange(struct ObjectEvent *, s16, s16);
 static bool8 IsMetatileDirectionallyImpassable(struct ObjectEvent *, s16, s16, u8);
-static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *, s16, s16);
+static u8 GetObjectEventTemplateCount(void);
+static void BuildObjectEventSpawnIndex(u8);
+static void TrySpawnObjectEventsInStrip(s16, s16, s16, bool8);
+static void TrySpawnObjectEventsForCameraUpdate(s16, s16);
 static void UpdateObjectEventOffscreen(struct ObjectEvent *, struct Sprite *);
 static void UpdateObjectEventSpriteVisibility(struct ObjectEvent *, struct Sprite *);
 static void ObjectEventUpdateMetatileBehaviors(struct ObjectEvent*);
@@ -1150,6 +1180,33 @@ static void ClearAllObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         ClearObjectEvent(&gObjectEvents[i]);
+    RebuildObjectEventOccupancy();
+}
+
+// Must be called after anything writes an object event's currentCoords or previousCoords.
+void UpdateObjectEventOccupancy(struct ObjectEvent *objectEvent)
+{
+    u32 id = objectEvent - gObjectEvents;
+    u16 bit = 1 << id;
+    u8 currentCell = OCCUPANCY_CELL(objectEvent->currentCoords.x, objectEvent->currentCoords.y);
+    u8 previousCell = OCCUPANCY_CELL(objectEvent->previousCoords.x, objectEvent->previousCoords.y);
+
+    sObjectEventOccupancy[sObjectEventOccupiedCells[id][0]] &= ~bit;
+    sObjectEventOccupancy[sObjectEventOccupiedCells[id][1]] &= ~bit;
+    sObjectEventOccupancy[currentCell] |= bit;
+    sObjectEventOccupancy[previousCell] |= bit;
+    sObjectEventOccupiedCells[id][0] = currentCell;
+    sObjectEventOccupiedCells[id][1] = previousCell;
+}
+
+void RebuildObjectEventOccupancy(void)
+{
+    u8 i;
+
+    for (i = 0; i < OCCUPANCY_CELL_COUNT; i++)
+        sObjectEventOccupancy[i] = 0;
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        UpdateObjectEventOccupancy(&gObjectEvents[i]);
 }
 
 void ResetObjectEvents(void)
@@ -1208,13 +1265,15 @@ bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u
 u8 GetObjectEventIdByXY(s16 x, s16 y)
 {
     u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u16 candidates = sObjectEventOccupancy[OCCUPANCY_CELL(x, y)];
+
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
-            break;
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
     }
 
-    return i;
+    return OBJECT_EVENTS_COUNT;
 }
 
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapGroupId)
@@ -1267,6 +1326,7 @@ static u8 InitObjectEventStateFromTemplate(struct ObjectEventTemplate *template,
     objectEvent->currentCoords.y = y;
     objectEvent->previousCoords.x = x;
     objectEvent->previousCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
     objectEvent->currentElevation = template->elevation;
     objectEvent->previousElevation = template->elevation;
     objectEvent->rangeX = template->movementRangeX;
@@ -1608,6 +1668,74 @@ u8 CreateObjectSprite(u16 graphicsId, u8 objectEventId, s16 x, s16 y, u8 z, u8 d
     return spriteId;
 }
 
+static u8 GetObjectEventTemplateCount(void)
+{
+    if (InBattlePyramid())
+        return GetNumBattlePyramidObjectEvents();
+    else if (InTrainerHill())
+        return 2;
+    else
+        return gMapHeader.events->objectEventCount;
+}
+
+void InvalidateObjectEventSpawnIndex(void)
+{
+    sObjectEventSpawnIndex.valid = FALSE;
+}
+
+// Called by FlagClear when a flag goes from set to clear.
+void RetryObjectEventSpawnsForFlag(u16 flagId)
+{
+    u8 i;
+    u8 objectCount;
+
+    if (gMapHeader.events == NULL || sObjectEventSpawnIndex.retrySweep)
+        return;
+
+    objectCount = GetObjectEventTemplateCount();
+    for (i = 0; i < objectCount; i++)
+    {
+        if (gSaveBlock1Ptr->objectEventTemplates[i].flagId == flagId)
+        {
+            sObjectEventSpawnIndex.retrySweep = TRUE;
+            break;
+        }
+    }
+}
+
+// Insertion sorts are fine here, there are at most OBJECT_EVENT_TEMPLATES_COUNT templates
+// and this only runs when a map's objects are set up or a template has been moved.
+static void BuildObjectEventSpawnIndex(u8 count)
+{
+    struct ObjectEventTemplate *templates = gSaveBlock1Ptr->objectEventTemplates;
+    s32 i, j;
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = i; j > 0 && templates[sObjectEventSpawnIndex.byX[j - 1]].x > templates[i].x; j--)
+            sObjectEventSpawnIndex.byX[j] = sObjectEventSpawnIndex.byX[j - 1];
+        sObjectEventSpawnIndex.byX[j] = i;
+
+        for (j = i; j > 0 && templates[sObjectEventSpawnIndex.byY[j - 1]].y > templates[i].y; j--)
+            sObjectEventSpawnIndex.byY[j] = sObjectEventSpawnIndex.byY[j - 1];
+        sObjectEventSpawnIndex.byY[j] = i;
+    }
+    sObjectEventSpawnIndex.count = count;
+    sObjectEventSpawnIndex.valid = TRUE;
+}
+
+static void TrySpawnObjectEventInView(struct ObjectEventTemplate *template, s16 cameraX, s16 cameraY)
+{
+    u8 mapNum = gSaveBlock1Ptr->location.mapNum;
+    u8 mapGroup = gSaveBlock1Ptr->location.mapGroup;
+
+    // A failed spawn of an object that isn't already out means the object events or
+    // sprites ran out, the template has to be tried again once one is freed.
+    if (TrySpawnObjectEventTemplate(template, mapNum, mapGroup, cameraX, cameraY) == OBJECT_EVENTS_COUNT
+     && GetObjectEventIdByLocalIdAndMap(template->localId, mapNum, mapGroup) == OBJECT_EVENTS_COUNT)
+        sObjectEventSpawnIndex.retrySweep = TRUE;
+}
+
 void TrySpawnObjectEvents(s16 cameraX, s16 cameraY)
 {
     u8 i;
@@ -1620,12 +1748,9 @@ void TrySpawnObjectEvents(s16 cameraX, s16 cameraY)
         s16 top = gSaveBlock1Ptr->pos.y;
         s16 bottom = gSaveBlock1Ptr->pos.y + 16;
 
-        if (InBattlePyramid())
-            objectCount = GetNumBattlePyramidObjectEvents();
-        else if (InTrainerHill())
-            objectCount = 2;
-        else
-            objectCount = gMapHeader.events->objectEventCount;
+        objectCount = GetObjectEventTemplateCount();
+        BuildObjectEventSpawnIndex(objectCount);
+        sObjectEventSpawnIndex.retrySweep = FALSE;
 
         for (i = 0; i < objectCount; i++)
         {
@@ -1635,30 +1760,94 @@ void TrySpawnObjectEvents(s16 cameraX, s16 cameraY)
 
             if (top <= npcY && bottom >= npcY && left <= npcX && right >= npcX
                 && !FlagGet(template->flagId))
-                TrySpawnObjectEventTemplate(template, gSaveBlock1Ptr->location.mapNum, gSaveBlock1Ptr->location.mapGroup, cameraX, cameraY);
+                TrySpawnObjectEventInView(template, cameraX, cameraY);
         }
     }
 }
 
+// Spawns the templates on one column (isColumn) or row of the view, looked up
+// in sObjectEventSpawnIndex instead of scanning every template.
+static void TrySpawnObjectEventsInStrip(s16 cameraX, s16 cameraY, s16 line, bool8 isColumn)
+{
+    struct ObjectEventTemplate *templates = gSaveBlock1Ptr->objectEventTemplates;
+    const u8 *sorted = isColumn ? sObjectEventSpawnIndex.byX : sObjectEventSpawnIndex.byY;
+    s16 min = isColumn ? gSaveBlock1Ptr->pos.y : gSaveBlock1Ptr->pos.x - 2;
+    s16 max = isColumn ? gSaveBlock1Ptr->pos.y + 16 : gSaveBlock1Ptr->pos.x + 17;
+    s32 lo = 0;
+    s32 hi = sObjectEventSpawnIndex.count;
+
+    // Find the first template on the strip's line
+    while (lo < hi)
+    {
+        s32 mid = (lo + hi) / 2;
+        struct ObjectEventTemplate *template = &templates[sorted[mid]];
+        if ((isColumn ? template->x : template->y) + 7 < line)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    for (; lo < sObjectEventSpawnIndex.count; lo++)
+    {
+        struct ObjectEventTemplate *template = &templates[sorted[lo]];
+        s16 npcLine = (isColumn ? template->x : template->y) + 7;
+        s16 npcPos = (isColumn ? template->y : template->x) + 7;
+
+        if (npcLine != line)
+            break;
+        if (min <= npcPos && max >= npcPos && !FlagGet(template->flagId))
+            TrySpawnObjectEventInView(template, cameraX, cameraY);
+    }
+}
+
+static void TrySpawnObjectEventsForCameraUpdate(s16 cameraX, s16 cameraY)
+{
+    if (gMapHeader.events == NULL)
+        return;
+
+    // Fall back to a full sweep, which rebuilds the index, whenever the templates
+    // may have changed under it, e.g. after crossing into a connected map, an
+    // earlier spawn failed for lack of free objects, or a template's flag was cleared.
+    if (!sObjectEventSpawnIndex.valid
+     || sObjectEventSpawnIndex.retrySweep
+     || sObjectEventSpawnIndex.count != GetObjectEventTemplateCount()
+     || cameraX < -1 || cameraX > 1 || cameraY < -1 || cameraY > 1)
+    {
+        TrySpawnObjectEvents(cameraX, cameraY);
+        return;
+    }
+
+    // Templates already in view were handled by earlier steps, so only the newly
+    // revealed column and row need checking. A template on both is only spawned once,
+    // an object with the same local id already exists the second time.
+    if (cameraX > 0)
+        TrySpawnObjectEventsInStrip(cameraX, cameraY, gSaveBlock1Ptr->pos.x + 17, TRUE);
+    else if (cameraX < 0)
+        TrySpawnObjectEventsInStrip(cameraX, cameraY, gSaveBlock1Ptr->pos.x - 2, TRUE);
+
+    if (cameraY > 0)
+        TrySpawnObjectEventsInStrip(cameraX, cameraY, gSaveBlock1Ptr->pos.y + 16, FALSE);
+    else if (cameraY < 0)
+        TrySpawnObjectEventsInStrip(cameraX, cameraY, gSaveBlock1Ptr->pos.y, FALSE);
+}
+
 void RemoveObjectEventsOutsideView(void)
 {
-    u8 i, j;
-    bool8 isActiveLinkPlayer;
+    u8 i;
+    u16 linkPlayerObjects = 0;
+
+    for (i = 0; i < ARRAY_COUNT(gLinkPlayerObjectEvents); i++)
+    {
+        if (gLinkPlayerObjectEvents[i].active)
+            linkPlayerObjects |= 1 << gLinkPlayerObjectEvents[i].objEventId;
+    }
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
     {
-        for (j = 0, isActiveLinkPlayer = FALSE; j < ARRAY_COUNT(gLinkPlayerObjectEvents); j++)
-        {
-            if (gLinkPlayerObjectEvents[j].active && i == gLinkPlayerObjectEvents[j].objEventId)
-                isActiveLinkPlayer = TRUE;
-        }
-        if (!isActiveLinkPlayer)
-        {
-            struct ObjectEvent *objectEvent = &gObjectEvents[i];
+        struct ObjectEvent *objectEvent = &gObjectEvents[i];
 
-            if (objectEvent->active && !objectEvent->isPlayer)
-                RemoveObjectEventIfOutsideView(objectEvent);
-        }
+        if (objectEvent->active && !objectEvent->isPlayer && !(linkPlayerObjects & (1 << i)))
+            RemoveObjectEventIfOutsideView(objectEvent);
     }
 }
 
@@ -2089,6 +2278,7 @@ static void IncrementObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x += x;
     objectEvent->currentCoords.y += y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2097,6 +2287,7 @@ void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2105,6 +2296,7 @@ static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 void MoveObjectEventToMapCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2163,16 +2355,18 @@ void UpdateObjectEventCoordsForCameraUpdate(void)
                 gObjectEvents[i].previousCoords.y -= dy;
             }
         }
+        RebuildObjectEventOccupancy();
     }
 }
 
 u8 GetObjectEventIdByXYZ(u16 x, u16 y, u8 z)
 {
     u8 i;
+    u16 candidates = sObjectEventOccupancy[OCCUPANCY_CELL(x, y)];
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active)
+        if ((candidates & 1) && gObjectEvents[i].active)
         {
             if (gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y && ObjectEventDoesZCoordMatch(&gObjectEvents[i], z))
             {
@@ -2195,7 +2389,7 @@ static bool8 ObjectEventDoesZCoordMatch(struct ObjectEvent *objectEvent, u8 z)
 void UpdateObjectEventsForCameraUpdate(s16 x, s16 y)
 {
     UpdateObjectEventCoordsForCameraUpdate();
-    TrySpawnObjectEvents(x, y);
+    TrySpawnObjectEventsForCameraUpdate(x, y);
     RemoveObjectEventsOutsideView();
 }
 
@@ -4788,15 +4982,16 @@ static bool8 IsMetatileDirectionallyImpassable(struct ObjectEvent *objectEvent,
     return FALSE;
 }
 
-static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16 x, s16 y)
+bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16 x, s16 y)
 {
     u8 i;
     struct ObjectEvent *curObject;
+    u16 candidates = sObjectEventOccupancy[OCCUPANCY_CELL(x, y)];
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
         curObject = &gObjectEvents[i];
-        if (curObject->active && curObject != objectEvent)
+        if ((candidates & 1) && curObject->active && curObject != objectEvent)
         {
             if ((curObject->currentCoords.x == x && curObject->currentCoords.y == y) || (curObject->previousCoords.x == x && curObject->previousCoords.y == y))
             {
@@ -11,6 +11,7 @@
 #include "rotating_gate.h"
 #include "sprite.h"
 #include "text.h"
+#include "tileset_anims.h"
 
 EWRAM_DATA bool8 gUnusedBikeCameraAheadPanback = FALSE;
 
@@ -33,6 +34,8 @@ static s32 MapPosToBgTilemapOffset(struct FieldCameraOffset *a, s32 x, s32 y);
 static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLayout);
 static void DrawMetatileAt(const struct MapLayout *mapLayout, u16, int, int);
 static void DrawMetatile(s32 a, u16 *b, u16 c);
+static void UpdateMetatileLayerTypeCache(const struct MapLayout *mapLayout);
+static void ScheduleFieldTilemapCopies(void);
 static void CameraPanningCB_PanAhead(void);
 
 // IWRAM bss vars
@@ -46,6 +49,17 @@ struct CameraObject gFieldCamera;
 u16 gTotalCameraPixelOffsetY;
 u16 gTotalCameraPixelOffsetX;
 
+// The layer type of every metatile in the current pair of tilesets, read once when the
+// tilesets change instead of through the map grid and attribute tables for every redrawn metatile.
+struct MetatileLayerTypeCache
+{
+    const struct Tileset *primaryTileset;
+    const struct Tileset *secondaryTileset;
+    u8 layerTypes[NUM_METATILES_TOTAL];
+};
+
+static EWRAM_DATA struct MetatileLayerTypeCache sMetatileLayerTypeCache = {0};
+
 // text
 static void ResetCameraOffset(struct FieldCameraOffset *cameraOffset)
 {
@@ -108,6 +122,7 @@ static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLa
     u32 r6;
     u8 temp;
 
+    UpdateMetatileLayerTypeCache(mapLayout);
     for (i = 0; i < 32; i += 2)
     {
         temp = sFieldCameraOffset.yTileOffset + i;
@@ -122,12 +137,14 @@ static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLa
             DrawMetatileAt(mapLayout, r6 + temp, x + j / 2, y + i / 2);
         }
     }
+    ScheduleFieldTilemapCopies();
 }
 
 static void RedrawMapSlicesForCameraUpdate(struct FieldCameraOffset *cameraOffset, int x, int y)
 {
     const struct MapLayout *mapLayout = gMapHeader.mapLayout;
 
+    UpdateMetatileLayerTypeCache(mapLayout);
     if (x > 0)
         RedrawMapSliceWest(cameraOffset, mapLayout);
     if (x < 0)
@@ -136,6 +153,7 @@ static void RedrawMapSlicesForCameraUpdate(struct FieldCameraOffset *cameraOffse
         RedrawMapSliceNorth(cameraOffset, mapLayout);
     if (y < 0)
         RedrawMapSliceSouth(cameraOffset, mapLayout);
+    ScheduleFieldTilemapCopies();
     cameraOffset->copyBGToVRAM = TRUE;
 }
 
@@ -211,7 +229,9 @@ void CurrentMapDrawMetatileAt(int x, int y)
 
     if (offset >= 0)
     {
+        UpdateMetatileLayerTypeCache(gMapHeader.mapLayout);
         DrawMetatileAt(gMapHeader.mapLayout, offset, x, y);
+        ScheduleFieldTilemapCopies();
         sFieldCameraOffset.copyBGToVRAM = TRUE;
     }
 }
@@ -223,15 +243,43 @@ void DrawDoorMetatileAt(int x, int y, u16 *arr)
     if (offset >= 0)
     {
         DrawMetatile(1, arr, offset);
+        ScheduleFieldTilemapCopies();
         sFieldCameraOffset.copyBGToVRAM = TRUE;
     }
 }
 
+static void UpdateMetatileLayerTypeCache(const struct MapLayout *mapLayout)
+{
+    u32 i;
+    const u16 *attributes;
+
+    if (sMetatileLayerTypeCache.primaryTileset == mapLayout->primaryTileset
+     && sMetatileLayerTypeCache.secondaryTileset == mapLayout->secondaryTileset)
+        return;
+
+    attributes = mapLayout->primaryTileset->metatileAttributes;
+    for (i = 0; i < NUM_METATILES_IN_PRIMARY; i++)
+        sMetatileLayerTypeCache.layerTypes[i] = (attributes[i] & METATILE_ELEVATION_MASK) >> METATILE_ELEVATION_SHIFT;
+
+    attributes = mapLayout->secondaryTileset->metatileAttributes;
+    for (i = 0; i < NUM_METATILES_TOTAL - NUM_METATILES_IN_PRIMARY; i++)
+        sMetatileLayerTypeCache.layerTypes[NUM_METATILES_IN_PRIMARY + i] = (attributes[i] & METATILE_ELEVATION_MASK) >> METATILE_ELEVATION_SHIFT;
+
+    sMetatileLayerTypeCache.primaryTileset = mapLayout->primaryTileset;
+    sMetatileLayerTypeCache.secondaryTileset = mapLayout->secondaryTileset;
+}
+
+// Callers must have called UpdateMetatileLayerTypeCache for mapLayout,
+// and must schedule the tilemap copies once they're done drawing.
 static void DrawMetatileAt(const struct MapLayout *mapLayout, u16 offset, int x, int y)
 {
     u16 metatileId = MapGridGetMetatileIdAt(x, y);
+    u8 layerType;
     u16 *metatiles;
 
+    // Metatile ids past the end of the secondary tileset behave as LAYER_TYPE_NORMAL
+    layerType = metatileId < NUM_METATILES_TOTAL ? sMetatileLayerTypeCache.layerTypes[metatileId] : 0;
+
     if (metatileId > NUM_METATILES_TOTAL)
         metatileId = 0;
     if (metatileId < NUM_METATILES_IN_PRIMARY)
@@ -241,7 +289,15 @@ static void DrawMetatileAt(const struct MapLayout *mapLayout, u16 offset, int x,
         metatiles = mapLayout->secondaryTileset->metatiles;
         metatileId -= NUM_METATILES_IN_PRIMARY;
     }
-    DrawMetatile(MapGridGetMetatileLayerTypeAt(x, y), metatiles + metatileId * 8, offset);
+    DrawMetatile(layerType, metatiles + metatileId * 8, offset);
+}
+
+static void ScheduleFieldTilemapCopies(void)
+{
+    InvalidateVisibleAnimTiles();
+    ScheduleBgCopyTilemapToVram(1);
+    ScheduleBgCopyTilemapToVram(2);
+    ScheduleBgCopyTilemapToVram(3);
 }
 
 static void DrawMetatile(s32 metatileLayerType, u16 *metatiles, u16 offset)
@@ -306,9 +362,6 @@ static void DrawMetatile(s32 metatileLayerType, u16 *metatiles, u16 offset)
         gBGTilemapBuffers2[offset + 0x21] = metatiles[7];
         break;
     }
-    ScheduleBgCopyTilemapToVram(1);
-    ScheduleBgCopyTilemapToVram(2);
-    ScheduleBgCopyTilemapToVram(3);
 }
 
 static s32 MapPosToBgTilemapOffset(struct FieldCameraOffset *cameraOffset, s32 x, s32 y)
@@ -31,6 +31,7 @@
 #include "constants/event_bg.h"
 #include "constants/event_objects.h"
 #include "constants/field_poison.h"
+#include "constants/map_events.h"
 #include "constants/map_types.h"
 #include "constants/maps.h"
 #include "constants/songs.h"
@@ -63,6 +64,7 @@ static bool8 TryDoorWarp(struct MapPosition *, u16, u8);
 static s8 GetWarpEventAtPosition(struct MapHeader *, u16, u16, u8);
 static u8 *GetCoordEventScriptAtPosition(struct MapHeader *, u16, u16, u8);
 static struct BgEvent *GetBackgroundEventAtPosition(struct MapHeader *, u16, u16, u8);
+static const struct MapEventPosition *GetFirstMapEventPosition(const struct MapEvents *, u16, u16);
 static bool8 TryStartCoordEventScript(struct MapPosition *);
 static bool8 TryStartWarpEventScript(struct MapPosition *, u16);
 static bool8 TryStartMiscWalkingScripts(u16);
@@ -866,11 +868,59 @@ static bool8 TryDoorWarp(struct MapPosition *position, u16 metatileBehavior, u8
     return FALSE;
 }
 
+#define MAP_EVENT_POSITION_KEY(x, y) (((u32)(y) << 16) | (u16)(x))
+#define MAP_EVENT_POSITION_COUNT(events) ((events)->warpCount + (events)->coordEventCount + (events)->bgEventCount)
+
+// Binary search of the map's position index for the first event at (x, y).
+// Returns NULL if the map has no index or nothing is at that position.
+static const struct MapEventPosition *GetFirstMapEventPosition(const struct MapEvents *events, u16 x, u16 y)
+{
+    const struct MapEventPosition *positions = events->positions;
+    u32 key = MAP_EVENT_POSITION_KEY(x, y);
+    s32 lo = 0;
+    s32 hi = MAP_EVENT_POSITION_COUNT(events);
+
+    if (positions == NULL)
+        return NULL;
+
+    while (lo < hi)
+    {
+        s32 mid = (lo + hi) / 2;
+        if (MAP_EVENT_POSITION_KEY(positions[mid].x, positions[mid].y) < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo < MAP_EVENT_POSITION_COUNT(events) && positions[lo].x == x && positions[lo].y == y)
+        return &positions[lo];
+    return NULL;
+}
+
 static s8 GetWarpEventAtPosition(struct MapHeader *mapHeader, u16 x, u16 y, u8 elevation)
 {
     s32 i;
     struct WarpEvent *warpEvent = mapHeader->events->warps;
     u8 warpCount = mapHeader->events->warpCount;
+    const struct MapEventPosition *position;
+
+    if (mapHeader->events->positions != NULL)
+    {
+        const struct MapEventPosition *end = mapHeader->events->positions + MAP_EVENT_POSITION_COUNT(mapHeader->events);
+
+        // Entries at the same position follow each other, in event index order per kind
+        for (position = GetFirstMapEventPosition(mapHeader->events, x, y);
+             position != NULL && position < end && position->x == x && position->y == y;
+             position++)
+        {
+            if (position->kind != MAP_EVENT_POSITION_WARP)
+                continue;
+            warpEvent = &mapHeader->events->warps[position->index];
+            if (warpEvent->elevation == elevation || warpEvent->elevation == 0)
+                return position->index;
+        }
+        return -1;
+    }
 
     for (i = 0; i < warpCount; i++, warpEvent++)
     {
@@ -908,6 +958,28 @@ static u8 *GetCoordEventScriptAtPosition(struct MapHeader *mapHeader, u16 x, u16
     s32 i;
     struct CoordEvent *coordEvents = mapHeader->events->coordEvents;
     u8 coordEventCount = mapHeader->events->coordEventCount;
+    const struct MapEventPosition *position;
+
+    if (mapHeader->events->positions != NULL)
+    {
+        const struct MapEventPosition *end = mapHeader->events->positions + MAP_EVENT_POSITION_COUNT(mapHeader->events);
+
+        for (position = GetFirstMapEventPosition(mapHeader->events, x, y);
+             position != NULL && position < end && position->x == x && position->y == y;
+             position++)
+        {
+            if (position->kind != MAP_EVENT_POSITION_COORD)
+                continue;
+            i = position->index;
+            if (coordEvents[i].elevation == elevation || coordEvents[i].elevation == 0)
+            {
+                u8 *script = TryRunCoordEventScript(&coordEvents[i]);
+                if (script != NULL)
+                    return script;
+            }
+        }
+        return NULL;
+    }
 
     for (i = 0; i < coordEventCount; i++)
     {
@@ -934,6 +1006,24 @@ static struct BgEvent *GetBackgroundEventAtPosition(struct MapHeader *mapHeader,
     u8 i;
     struct BgEvent *bgEvents = mapHeader->events->bgEvents;
     u8 bgEventCount = mapHeader->events->bgEventCount;
+    const struct MapEventPosition *position;
+
+    if (mapHeader->events->positions != NULL)
+    {
+        const struct MapEventPosition *end = mapHeader->events->positions + MAP_EVENT_POSITION_COUNT(mapHeader->events);
+
+        for (position = GetFirstMapEventPosition(mapHeader->events, x, y);
+             position != NULL && position < end && position->x == x && position->y == y;
+             position++)
+        {
+            if (position->kind != MAP_EVENT_POSITION_BG)
+                continue;
+            i = position->index;
+            if (bgEvents[i].elevation == elevation || bgEvents[i].elevation == 0)
+                return &bgEvents[i];
+        }
+        return NULL;
+    }
 
     for (i = 0; i < bgEventCount; i++)
     {
@@ -51,6 +51,7 @@ static bool8 LightenSpritePaletteInFog(u8);
 static void BuildGammaShiftTables(void);
 static void UpdateWeatherGammaShift(void);
 static void ApplyGammaShift(u8 startPalIndex, u8 numPalettes, s8 gammaIndex);
+static const u16 *GetGammaShiftColorTable(s8 gammaIndex, bool8 alt);
 static void ApplyGammaShiftWithBlend(u8 startPalIndex, u8 numPalettes, s8 gammaIndex, u8 blendCoeff, u16 blendColor);
 static void ApplyDroughtGammaShiftWithBlend(s8 gammaIndex, u8 blendCoeff, u16 blendColor);
 static void ApplyFogBlend(u8 blendCoeff, u16 blendColor);
@@ -114,6 +115,30 @@ void (*const gWeatherPalStateFuncs[])(void) =
     [WEATHER_PAL_STATE_IDLE]              = DoNothing,             
 };
 
+// gammaShifts and altGammaShifts for one gamma index, pre-shifted into each color channel,
+// so shifting a color is three lookups ORed together. Rebuilt when the gamma index changes.
+struct GammaShiftColorTable
+{
+    s8 gammaIndex;
+    u16 colors[2][3][32]; // [normal, alt][r, g, b]
+};
+
+EWRAM_DATA static struct GammaShiftColorTable sGammaShiftColorTable = {0};
+
+// Fog lightens marked sprite palettes towards RGB(28, 31, 28) before blending:
+// c + ((target - c) * 3 >> 2) for target 28 and 31.
+static const u8 sFogLightenTo28[32] =
+{
+    21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24,
+    25, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28,
+};
+
+static const u8 sFogLightenTo31[32] =
+{
+    23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27,
+    27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31,
+};
+
 // This table specifies which of the gamma shift tables should be
 // applied to each of the background and sprite palettes.
 static const u8 sBasePaletteGammaTypes[32] =
@@ -284,6 +309,7 @@ static void BuildGammaShiftTables(void)
     s16 dunno;
 
     sPaletteGammaTypes = sBasePaletteGammaTypes;
+    sGammaShiftColorTable.gammaIndex = -1;
     for (v0 = 0; v0 <= 1; v0++)
     {
         if (v0 == 0)
@@ -454,11 +480,34 @@ static bool8 FadeInScreen_FogHorizontal(void)
 static void DoNothing(void)
 { }
 
+// gammaIndex is the index into gammaShifts, i.e. already decremented
+static const u16 *GetGammaShiftColorTable(s8 gammaIndex, bool8 alt)
+{
+    if (sGammaShiftColorTable.gammaIndex != gammaIndex)
+    {
+        u32 i;
+        const u8 *gammaTable = gWeatherPtr->gammaShifts[gammaIndex];
+        const u8 *altGammaTable = gWeatherPtr->altGammaShifts[gammaIndex];
+
+        for (i = 0; i < 32; i++)
+        {
+            sGammaShiftColorTable.colors[0][0][i] = RGB2(gammaTable[i], 0, 0);
+            sGammaShiftColorTable.colors[0][1][i] = RGB2(0, gammaTable[i], 0);
+            sGammaShiftColorTable.colors[0][2][i] = RGB2(0, 0, gammaTable[i]);
+            sGammaShiftColorTable.colors[1][0][i] = RGB2(altGammaTable[i], 0, 0);
+            sGammaShiftColorTable.colors[1][1][i] = RGB2(0, altGammaTable[i], 0);
+            sGammaShiftColorTable.colors[1][2][i] = RGB2(0, 0, altGammaTable[i]);
+        }
+        sGammaShiftColorTable.gammaIndex = gammaIndex;
+    }
+    return sGammaShiftColorTable.colors[alt ? 1 : 0][0];
+}
+
 static void ApplyGammaShift(u8 startPalIndex, u8 numPalettes, s8 gammaIndex)
 {
     u16 curPalIndex;
     u16 palOffset;
-    u8 *gammaTable;
+    const u16 *colorTable;
     u16 i;
 
     if (gammaIndex > 0)
@@ -479,21 +528,15 @@ static void ApplyGammaShift(u8 startPalIndex, u8 numPalettes, s8 gammaIndex)
             }
             else
             {
-                u8 r, g, b;
-
-                if (sPaletteGammaTypes[curPalIndex] == GAMMA_ALT || curPalIndex - 16 == gWeatherPtr->altGammaSpritePalIndex)
-                    gammaTable = gWeatherPtr->altGammaShifts[gammaIndex];
-                else
-                    gammaTable = gWeatherPtr->gammaShifts[gammaIndex];
+                colorTable = GetGammaShiftColorTable(gammaIndex, sPaletteGammaTypes[curPalIndex] == GAMMA_ALT || curPalIndex - 16 == gWeatherPtr->altGammaSpritePalIndex);
 
                 for (i = 0; i < 16; i++)
                 {
                     // Apply gamma shift to the original color.
-                    struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                    r = gammaTable[baseColor.r];
-                    g = gammaTable[baseColor.g];
-                    b = gammaTable[baseColor.b];
-                    gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
+                    u16 baseColor = gPlttBufferUnfaded[palOffset];
+                    gPlttBufferFaded[palOffset++] = colorTable[baseColor & 0x1F]
+                                                  | colorTable[32 + ((baseColor >> 5) & 0x1F)]
+                                                  | colorTable[64 + ((baseColor >> 10) & 0x1F)];
                 }
             }
 
@@ -669,9 +712,9 @@ static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
                 u8 g = color.g;
                 u8 b = color.b;
 
-                r += ((28 - r) * 3) >> 2;
-                g += ((31 - g) * 3) >> 2;
-                b += ((28 - b) * 3) >> 2;
+                r = sFogLightenTo28[r];
+                g = sFogLightenTo31[g];
+                b = sFogLightenTo28[b];
 
                 r += ((rBlend - r) * blendCoeff) >> 4;
                 g += ((gBlend - g) * blendCoeff) >> 4;
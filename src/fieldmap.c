@@ -13,6 +13,7 @@
 #include "script.h"
 #include "secret_base.h"
 #include "trainer_hill.h"
+#include "trainer_see.h"
 #include "tv.h"
 #include "constants/rgb.h"
 #include "constants/metatile_behaviors.h"
@@ -87,12 +88,14 @@ void InitMapFromSavedGame(void)
 
 void InitBattlePyramidMap(bool8 setPlayerPosition)
 {
+    InvalidateTrainerSightCache();
     CpuFastFill(METATILE_ID_UNDEFINED << 16 | METATILE_ID_UNDEFINED, gBackupMapData, sizeof(gBackupMapData));
     GenerateBattlePyramidFloorLayout(gBackupMapData, setPlayerPosition);
 }
 
 void InitTrainerHillMap(void)
 {
+    InvalidateTrainerSightCache();
     CpuFastFill(METATILE_ID_UNDEFINED << 16 | METATILE_ID_UNDEFINED, gBackupMapData, sizeof(gBackupMapData));
     GenerateTrainerHillFloorLayout(gBackupMapData);
 }
@@ -103,6 +106,7 @@ static void InitMapLayoutData(struct MapHeader *mapHeader)
     int width;
     int height;
     mapLayout = mapHeader->mapLayout;
+    InvalidateTrainerSightCache();
     CpuFastFill16(METATILE_ID_UNDEFINED, gBackupMapData, sizeof(gBackupMapData));
     gBackupMapLayout.map = gBackupMapData;
     width = mapLayout->width + 15;
@@ -391,6 +395,7 @@ void MapGridSetMetatileIdAt(int x, int y, u16 metatile)
     {
         i = x + y * gBackupMapLayout.width;
         gBackupMapLayout.map[i] = (gBackupMapLayout.map[i] & METATILE_ELEVATION_MASK) | (metatile & ~METATILE_ELEVATION_MASK);
+        InvalidateTrainerSightCache();
     }
 }
 
@@ -401,6 +406,7 @@ void MapGridSetMetatileEntryAt(int x, int y, u16 metatile)
     {
         i = x + gBackupMapLayout.width * y;
         gBackupMapLayout.map[i] = metatile;
+        InvalidateTrainerSightCache();
     }
 }
 
@@ -820,6 +826,7 @@ void MapGridSetMetatileImpassabilityAt(int x, int y, bool32 impassable)
             gBackupMapLayout.map[x + gBackupMapLayout.width * y] |= METATILE_COLLISION_MASK;
         else
             gBackupMapLayout.map[x + gBackupMapLayout.width * y] &= ~METATILE_COLLISION_MASK;
+        InvalidateTrainerSightCache();
     }
 }
 
@@ -236,4 +236,5 @@ void sub_81DB620(int windowId, int columnStart, int rowStart, int numFillTiles,
             rowsToFill--;
         }
     }
+    MarkWindowPixelRectDirty(windowId, columnStart * 8, rowStart * 8, numFillTiles * 8, numRows * 8);
 }
@@ -20,10 +20,19 @@ extern u16 gUnknown_0203CF30[];
 // this file's functions
 static bool8 CheckPyramidBagHasItem(u16 itemId, u16 count);
 static bool8 CheckPyramidBagHasSpace(u16 itemId, u16 count);
+static u8 GetFirstBagItemSlot(u8 pocket, u16 itemId);
+static void SetBagItemSlotIfEarlier(u16 itemId, u8 slot);
+static void AdvanceBagItemSlot(u8 pocket, u16 itemId);
 
 // EWRAM variables
 EWRAM_DATA struct BagPocket gBagPockets[POCKETS_COUNT] = {0};
 
+// First slot holding each item in its pocket, plus one; 0 means the item is not
+// in the bag. Kept up to date by the add and remove paths and rebuilt lazily
+// after anything else rearranges the pockets.
+EWRAM_DATA static u8 sBagItemSlots[ITEMS_COUNT] = {0};
+EWRAM_DATA static bool8 sBagItemSlotsValid = FALSE;
+
 // rodata
 #include "data/text/item_descriptions.h"
 #include "data/items.h"
@@ -89,6 +98,84 @@ void SetBagItemsPointers(void)
 
     gBagPockets[MEGA_STONES_POCKET].itemSlots = gSaveBlock1Ptr->bagPocket_MegaStones;
     gBagPockets[MEGA_STONES_POCKET].capacity = BAG_MEGASTONES_COUNT;
+
+    InvalidateBagItemIndex();
+}
+
+void InvalidateBagItemIndex(void)
+{
+    sBagItemSlotsValid = FALSE;
+}
+
+static void BuildBagItemIndex(void)
+{
+    u32 pocket, i;
+    u16 itemId;
+
+    memset(sBagItemSlots, 0, sizeof(sBagItemSlots));
+    for (pocket = 0; pocket < POCKETS_COUNT; pocket++)
+    {
+        for (i = 0; i < gBagPockets[pocket].capacity; i++)
+        {
+            itemId = gBagPockets[pocket].itemSlots[i].itemId;
+            if (itemId != ITEM_NONE && itemId < ITEMS_COUNT && sBagItemSlots[itemId] == 0)
+                sBagItemSlots[itemId] = i + 1;
+        }
+    }
+    sBagItemSlotsValid = TRUE;
+}
+
+// Returns the first slot of the pocket that can hold itemId, or the pocket's
+// capacity if the item is not in the bag. Scanning from the returned slot
+// visits every stack of the item.
+static u8 GetFirstBagItemSlot(u8 pocket, u16 itemId)
+{
+    u8 slot;
+
+    if (itemId >= ITEMS_COUNT)
+        return 0;
+    if (!sBagItemSlotsValid)
+        BuildBagItemIndex();
+
+    slot = sBagItemSlots[itemId];
+    if (slot != 0 && gBagPockets[pocket].itemSlots[slot - 1].itemId != itemId)
+    {
+        // The pocket was changed behind the index's back.
+        BuildBagItemIndex();
+        slot = sBagItemSlots[itemId];
+        if (slot != 0 && gBagPockets[pocket].itemSlots[slot - 1].itemId != itemId)
+            return 0;
+    }
+
+    if (slot == 0)
+        return gBagPockets[pocket].capacity;
+    return slot - 1;
+}
+
+static void SetBagItemSlotIfEarlier(u16 itemId, u8 slot)
+{
+    if (sBagItemSlotsValid && itemId < ITEMS_COUNT
+     && (sBagItemSlots[itemId] == 0 || slot < sBagItemSlots[itemId] - 1))
+        sBagItemSlots[itemId] = slot + 1;
+}
+
+// Moves the index past stacks of itemId that were emptied.
+static void AdvanceBagItemSlot(u8 pocket, u16 itemId)
+{
+    u8 i;
+
+    if (!sBagItemSlotsValid || itemId >= ITEMS_COUNT || sBagItemSlots[itemId] == 0)
+        return;
+
+    for (i = sBagItemSlots[itemId] - 1; i < gBagPockets[pocket].capacity; i++)
+    {
+        if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
+        {
+            sBagItemSlots[itemId] = i + 1;
+            return;
+        }
+    }
+    sBagItemSlots[itemId] = 0;
 }
 
 void CopyItemName(u16 itemId, u8 *dst)
@@ -147,7 +234,7 @@ bool8 CheckBagHasItem(u16 itemId, u16 count)
         return CheckPyramidBagHasItem(itemId, count);
     pocket = ItemId_GetPocket(itemId) - 1;
     // Check for item slots that contain the item
-    for (i = 0; i < gBagPockets[pocket].capacity; i++)
+    for (i = GetFirstBagItemSlot(pocket, itemId); i < gBagPockets[pocket].capacity; i++)
     {
         if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
         {
@@ -203,7 +290,7 @@ bool8 CheckBagHasSpace(u16 itemId, u16 count)
         slotCapacity = MAX_BERRY_CAPACITY;
 
     // Check space in any existing item slots that already contain this item
-    for (i = 0; i < gBagPockets[pocket].capacity; i++)
+    for (i = GetFirstBagItemSlot(pocket, itemId); i < gBagPockets[pocket].capacity; i++)
     {
         if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
         {
@@ -280,9 +367,9 @@ bool8 AddBagItem(u16 itemId, u16 count)
         else
         {
             slotCapacity = MAX_BAG_ITEM_CAPACITY;
-        }    
-  
-        for (i = 0; i < itemPocket->capacity; i++)
+        }
+
+        for (i = GetFirstBagItemSlot(pocket, itemId); i < itemPocket->capacity; i++)
         {
             if (newItems[i].itemId == itemId)
             {
@@ -327,6 +414,7 @@ bool8 AddBagItem(u16 itemId, u16 count)
                 if (newItems[i].itemId == ITEM_NONE)
                 {
                     newItems[i].itemId = itemId;
+                    SetBagItemSlotIfEarlier(itemId, i);
                     if (count > slotCapacity)
                     {
                         // try creating a new slot with max capacity if duplicates are possible
@@ -383,7 +471,7 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
         pocket = ItemId_GetPocket(itemId) - 1;
         itemPocket = &gBagPockets[pocket];
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        for (i = GetFirstBagItemSlot(pocket, itemId); i < itemPocket->capacity; i++)
         {
             if (itemPocket->itemSlots[i].itemId == itemId)
                 totalQuantity += GetBagItemQuantity(&itemPocket->itemSlots[i].quantity);
@@ -415,13 +503,16 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
             }
 
             if (GetBagItemQuantity(&itemPocket->itemSlots[var].quantity) == 0)
+            {
                 itemPocket->itemSlots[var].itemId = ITEM_NONE;
+                AdvanceBagItemSlot(pocket, itemId);
+            }
 
             if (count == 0)
                 return TRUE;
         }
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        for (i = GetFirstBagItemSlot(pocket, itemId); i < itemPocket->capacity; i++)
         {
             if (itemPocket->itemSlots[i].itemId == itemId)
             {
@@ -438,7 +529,10 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
                 }
 
                 if (GetBagItemQuantity(&itemPocket->itemSlots[i].quantity) == 0)
+                {
                     itemPocket->itemSlots[i].itemId = ITEM_NONE;
+                    AdvanceBagItemSlot(pocket, itemId);
+                }
 
                 if (count == 0)
                     return TRUE;
@@ -462,6 +556,7 @@ void ClearItemSlots(struct ItemSlot *itemSlots, u8 itemCount)
         itemSlots[i].itemId = ITEM_NONE;
         SetBagItemQuantity(&itemSlots[i].quantity, 0);
     }
+    InvalidateBagItemIndex();
 }
 
 static s32 FindFreePCItemSlot(void)
@@ -610,44 +705,65 @@ u16 BagGetQuantityByPocketPosition(u8 pocketId, u16 pocketPos)
     return GetBagItemQuantity(&gBagPockets[pocketId - 1].itemSlots[pocketPos].quantity);
 }
 
-static void SwapItemSlots(struct ItemSlot *a, struct ItemSlot *b)
+// Moves the non-empty slots to the front of the pocket, keeping their order,
+// and returns how many there are.
+static u16 CompactBagPocketSlots(struct BagPocket *bagPocket)
 {
-    struct ItemSlot temp;
-    SWAP(*a, *b, temp);
-}
+    u16 i, count;
 
-void CompactItemsInBagPocket(struct BagPocket *bagPocket)
-{
-    u16 i, j;
-
-    for (i = 0; i < bagPocket->capacity - 1; i++)
+    for (i = 0, count = 0; i < bagPocket->capacity; i++)
     {
-        for (j = i + 1; j < bagPocket->capacity; j++)
+        if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) != 0)
         {
-            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) == 0)
-                SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
+            if (i != count)
+                bagPocket->itemSlots[count] = bagPocket->itemSlots[i];
+            count++;
         }
     }
+    ClearItemSlots(&bagPocket->itemSlots[count], bagPocket->capacity - count);
+    return count;
 }
 
-void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
+void CompactItemsInBagPocket(struct BagPocket *bagPocket)
 {
-    u16 i, j;
+    CompactBagPocketSlots(bagPocket);
+}
 
-    for (i = 0; i < bagPocket->capacity - 1; i++)
+// Stable bottom-up merge sort of the compacted slots by item id, so stacks of
+// the same item keep the order the player left them in.
+void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
+{
+    u16 count = CompactBagPocketSlots(bagPocket);
+    u16 width, left, mid, right, i, j, k;
+    struct ItemSlot *src, *dst, *temp;
+    struct ItemSlot *buffer;
+
+    if (count < 2)
+        return;
+
+    buffer = Alloc(count * sizeof(struct ItemSlot));
+    src = bagPocket->itemSlots;
+    dst = buffer;
+    for (width = 1; width < count; width *= 2)
     {
-        for (j = i + 1; j < bagPocket->capacity; j++)
+        for (left = 0; left < count; left += 2 * width)
         {
-            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) != 0)
+            mid = min(left + width, count);
+            right = min(left + 2 * width, count);
+            for (i = left, j = mid, k = left; k < right; k++)
             {
-                if (GetBagItemQuantity(&bagPocket->itemSlots[j].quantity) == 0)
-                    continue;
-                if (bagPocket->itemSlots[i].itemId <= bagPocket->itemSlots[j].itemId)
-                    continue;
+                if (i < mid && (j >= right || src[i].itemId <= src[j].itemId))
+                    dst[k] = src[i++];
+                else
+                    dst[k] = src[j++];
             }
-            SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
         }
+        SWAP(src, dst, temp);
     }
+
+    if (src != bagPocket->itemSlots)
+        memcpy(bagPocket->itemSlots, src, count * sizeof(struct ItemSlot));
+    Free(buffer);
 }
 
 void MoveItemSlotInList(struct ItemSlot* itemSlots_, u32 from, u32 to_)
@@ -661,6 +777,7 @@ void MoveItemSlotInList(struct ItemSlot* itemSlots_, u32 from, u32 to_)
         s16 i, count;
         struct ItemSlot firstSlot = itemSlots[from];
 
+        InvalidateBagItemIndex();
         if (to > from)
         {
             to--;
@@ -690,9 +807,10 @@ u16 CountTotalItemQuantityInBag(u16 itemId)
 {
     u16 i;
     u16 ownedCount = 0;
-    struct BagPocket *bagPocket = &gBagPockets[ItemId_GetPocket(itemId) - 1];
+    u8 pocket = ItemId_GetPocket(itemId) - 1;
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
 
-    for (i = 0; i < bagPocket->capacity; i++)
+    for (i = GetFirstBagItemSlot(pocket, itemId); i < bagPocket->capacity; i++)
     {
         if (bagPocket->itemSlots[i].itemId == itemId)
             ownedCount += GetBagItemQuantity(&bagPocket->itemSlots[i].quantity);
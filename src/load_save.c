@@ -1,6 +1,7 @@
 #include "global.h"
 #include "malloc.h"
 #include "berry_powder.h"
+#include "event_object_movement.h"
 #include "item.h"
 #include "load_save.h"
 #include "main.h"
@@ -188,6 +189,7 @@ void LoadObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         gObjectEvents[i] = gSaveBlock1Ptr->objectEvents[i];
+    RebuildObjectEventOccupancy();
 }
 
 void SaveSerializedGame(void)
@@ -290,6 +292,7 @@ void SavePlayerBag(void)
     gSaveBlock2Ptr->encryptionKey = gLastEncryptionKey;
     ApplyNewEncryptionKeyToBagItems(encryptionKeyBackup);
     gSaveBlock2Ptr->encryptionKey = encryptionKeyBackup; // updated twice?
+    InvalidateBagItemIndex();
 }
 
 void ApplyNewEncryptionKeyToHword(u16 *hWord, u32 newKey)
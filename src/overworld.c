@@ -488,6 +488,7 @@ void LoadObjEventTemplatesFromHeader(void)
     CpuCopy32(gMapHeader.events->objectEvents,
               gSaveBlock1Ptr->objectEventTemplates,
               gMapHeader.events->objectEventCount * sizeof(struct ObjectEventTemplate));
+    InvalidateObjectEventSpawnIndex();
 }
 
 void LoadSaveblockObjEventScripts(void)
@@ -512,6 +513,7 @@ void Overworld_SetObjEventTemplateCoords(u8 localId, s16 x, s16 y)
         {
             objectEventTemplate->x = x;
             objectEventTemplate->y = y;
+            InvalidateObjectEventSpawnIndex();
             return;
         }
     }
@@ -2958,6 +2960,7 @@ static void InitLinkPlayerObjectEventPos(struct ObjectEvent *objEvent, s16 x, s1
     objEvent->currentCoords.y = y;
     objEvent->previousCoords.x = x;
     objEvent->previousCoords.y = y;
+    UpdateObjectEventOccupancy(objEvent);
     SetSpritePosToMapCoords(x, y, &objEvent->initialCoords.x, &objEvent->initialCoords.y);
     objEvent->initialCoords.x += 8;
     ObjectEventUpdateZCoord(objEvent);
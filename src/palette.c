@@ -53,6 +53,7 @@ static u8 UpdateHardwarePaletteFade(void);
 static void UpdateBlendRegisters(void);
 static bool8 IsSoftwarePaletteFadeFinishing(void);
 static void Task_BlendPalettesGradually(u8 taskId);
+static void BlendPalettesWithTables(u32 selectedPalettes, u16 paletteOffset, u8 coeff, u16 color);
 
 // palette buffers require alignment with agbcc because
 // unaligned word reads are issued in BlendPalette otherwise
@@ -64,6 +65,33 @@ static EWRAM_DATA u32 sFiller = 0;
 static EWRAM_DATA u32 sPlttBufferTransferPending = 0;
 EWRAM_DATA u8 gPaletteDecompressionBuffer[PLTT_DECOMP_BUFFER_SIZE] = {0};
 
+// Per-channel results of blending each of the 32 intensity levels towards
+// the current blend color, already shifted into place. Rebuilt only when the
+// coefficient or blend color changes, so a fade step over many palettes is
+// three lookups per color.
+static struct {
+    u16 r[32];
+    u16 g[32];
+    u16 b[32];
+    u16 color;
+    u8 coeff;
+    bool8 valid;
+} sBlendTables;
+
+// Recently hue shifted mon palettes, keyed by their compressed source and
+// hue index, so reloading the same mon skips decompression and the shift.
+#define HUE_SHIFT_CACHE_SIZE 8
+
+struct HueShiftCacheEntry
+{
+    const u32 *src;
+    u8 hueIndex;
+    u16 colors[16];
+};
+
+static EWRAM_DATA struct HueShiftCacheEntry sHueShiftCache[HUE_SHIFT_CACHE_SIZE] = {0};
+static EWRAM_DATA u8 sHueShiftCacheNext = 0;
+
 static const struct PaletteStructTemplate gDummyPaletteStructTemplate = {
     .uid = 0xFFFF,
     .pst_field_B_5 = 1
@@ -183,10 +211,12 @@ static inline s32 RoundClampShift(fixed v) {
  * Performs a hue shift on the colors in a given palette. Index must be from 0 to 63.
  * Values 0-31 shift right, while values 32-63 shift left (but 32 is treated as 0, 33 as 1, etc.).
  ***/
+#define GET_HUE_INDEX(personality) (((personality) >> 16) & (64-1))
+
 void HueShiftMonPalette(u16* colors, u32 personality) {
     //Use third personality byte to determine color;
     //Limit the index to valid bounds
-    u32 index = (personality >> 16) & (64-1);
+    u32 index = GET_HUE_INDEX(personality);
 
     //sCosTable and sSinTable are two tables for precalculated cosine values, one after other, each with 32
     //elements of two bytes. The values are represented in fixed point, and the table doesn't go very far around the
@@ -229,11 +259,44 @@ void HueShiftMonPalette(u16* colors, u32 personality) {
     }
 }
 
+static struct HueShiftCacheEntry *GetHueShiftCacheEntry(const u32 *src, u8 hueIndex)
+{
+    u32 i;
+
+    for (i = 0; i < HUE_SHIFT_CACHE_SIZE; i++)
+    {
+        if (sHueShiftCache[i].src == src && sHueShiftCache[i].hueIndex == hueIndex)
+            return &sHueShiftCache[i];
+    }
+    return NULL;
+}
+
 void LoadHueShiftedMonPalette(const u32 *src, u16 offset, u16 size, u32 personality)
 {
-    LZDecompressWram(src, gPaletteDecompressionBuffer);
+    struct HueShiftCacheEntry *entry;
+    u8 hueIndex = GET_HUE_INDEX(personality);
 
-    HueShiftMonPalette((u16*) gPaletteDecompressionBuffer, personality);
+    // Palettes decompressed from RAM may change between loads, so only ROM sources are cached.
+    if (size > sizeof(entry->colors) || ((u32)src >= EWRAM_START && (u32)src < IWRAM_END))
+    {
+        LZDecompressWram(src, gPaletteDecompressionBuffer);
+        HueShiftMonPalette((u16*) gPaletteDecompressionBuffer, personality);
+    }
+    else if ((entry = GetHueShiftCacheEntry(src, hueIndex)) != NULL)
+    {
+        CpuCopy16(entry->colors, gPaletteDecompressionBuffer, sizeof(entry->colors));
+    }
+    else
+    {
+        LZDecompressWram(src, gPaletteDecompressionBuffer);
+        HueShiftMonPalette((u16*) gPaletteDecompressionBuffer, personality);
+
+        entry = &sHueShiftCache[sHueShiftCacheNext];
+        entry->src = src;
+        entry->hueIndex = hueIndex;
+        CpuCopy16(gPaletteDecompressionBuffer, entry->colors, sizeof(entry->colors));
+        sHueShiftCacheNext = (sHueShiftCacheNext + 1) % HUE_SHIFT_CACHE_SIZE;
+    }
 
     CpuCopy16(gPaletteDecompressionBuffer, gPlttBufferUnfaded + offset, size);
     CpuCopy16(gPaletteDecompressionBuffer, gPlttBufferFaded + offset, size);
@@ -594,17 +657,7 @@ static u8 UpdateNormalPaletteFade(void)
             paletteOffset = 256;
         }
 
-        while (selectedPalettes)
-        {
-            if (selectedPalettes & 1)
-                BlendPalette(
-                    paletteOffset,
-                    16,
-                    gPaletteFade.y,
-                    gPaletteFade.blendColor);
-            selectedPalettes >>= 1;
-            paletteOffset += 16;
-        }
+        BlendPalettesWithTables(selectedPalettes, paletteOffset, gPaletteFade.y, gPaletteFade.blendColor);
 
         gPaletteFade.objPaletteToggle ^= 1;
 
@@ -982,16 +1035,56 @@ static bool8 IsSoftwarePaletteFadeFinishing(void)
     }
 }
 
-void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color)
+// Same result as BlendPalette for every color, see util.c
+static void BuildBlendTables(u8 coeff, u16 color)
 {
-    u16 paletteOffset;
+    struct PlttData *blendColor = (struct PlttData *)&color;
+    s32 i;
 
-    for (paletteOffset = 0; selectedPalettes; paletteOffset += 16)
+    for (i = 0; i < 32; i++)
     {
-        if (selectedPalettes & 1)
-            BlendPalette(paletteOffset, 16, coeff, color);
-        selectedPalettes >>= 1;
+        sBlendTables.r[i] = i + (((blendColor->r - i) * coeff) >> 4);
+        sBlendTables.g[i] = (i + (((blendColor->g - i) * coeff) >> 4)) << 5;
+        sBlendTables.b[i] = (i + (((blendColor->b - i) * coeff) >> 4)) << 10;
     }
+
+    sBlendTables.color = color;
+    sBlendTables.coeff = coeff;
+    sBlendTables.valid = TRUE;
+}
+
+#define BLEND_COLOR_WITH_TABLES(c) (sBlendTables.r[(c) & 0x1F] | sBlendTables.g[((c) >> 5) & 0x1F] | sBlendTables.b[((c) >> 10) & 0x1F])
+
+// Blends whole 16 color palettes from gPlttBufferUnfaded into gPlttBufferFaded,
+// two colors per word. Both buffers are word aligned, see above.
+static void BlendPalettesWithTables(u32 selectedPalettes, u16 paletteOffset, u8 coeff, u16 color)
+{
+    const u32 *src;
+    u32 *dest;
+    u32 colors;
+    s32 i;
+
+    if (!sBlendTables.valid || sBlendTables.coeff != coeff || sBlendTables.color != color)
+        BuildBlendTables(coeff, color);
+
+    for (; selectedPalettes; paletteOffset += 16, selectedPalettes >>= 1)
+    {
+        if (!(selectedPalettes & 1))
+            continue;
+
+        src = (const u32 *)&gPlttBufferUnfaded[paletteOffset];
+        dest = (u32 *)&gPlttBufferFaded[paletteOffset];
+        for (i = 0; i < 8; i++)
+        {
+            colors = *src++;
+            *dest++ = BLEND_COLOR_WITH_TABLES(colors & 0xFFFF) | (BLEND_COLOR_WITH_TABLES(colors >> 16) << 16);
+        }
+    }
+}
+
+void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color)
+{
+    BlendPalettesWithTables(selectedPalettes, 0, coeff, color);
 }
 
 void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u16 color)
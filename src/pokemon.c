@@ -64,6 +64,7 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon);
 static union PokemonSubstruct *GetSubstruct(struct BoxPokemon *boxMon, u32 personality, u8 substructType);
 static void EncryptBoxMon(struct BoxPokemon *boxMon);
 static void DecryptBoxMon(struct BoxPokemon *boxMon);
+static u8 GetLevelFromExp(u16 species, u32 exp);
 static void Task_PlayMapChosenOrBattleBGM(u8 taskId);
 // static u16 GiveMoveToBoxMon(struct BoxPokemon *boxMon, u16 move);
 static bool8 ShouldSkipFriendshipChange(void);
@@ -98,1718 +99,49 @@ static const struct CombinedMove sCombinedMoves[2] =
 
 #define SPECIES_TO_HOENN(name)      [SPECIES_##name - 1] = HOENN_DEX_##name
 #define SPECIES_TO_NATIONAL(name)   [SPECIES_##name - 1] = NATIONAL_DEX_##name
+#define FORM_SPECIES_TO_NATIONAL(form, name) [SPECIES_##form - 1] = NATIONAL_DEX_##name
 #define HOENN_TO_NATIONAL(name)     [HOENN_DEX_##name - 1] = NATIONAL_DEX_##name
 
 const u16 gSpeciesToHoennPokedexNum[NUM_SPECIES] = // Assigns all species to the Hoenn Dex Index (Summary No. for Hoenn Dex)
 {
-    SPECIES_TO_HOENN(TREECKO),
-    SPECIES_TO_HOENN(GROVYLE),
-    SPECIES_TO_HOENN(SCEPTILE),
-    SPECIES_TO_HOENN(TORCHIC),
-    SPECIES_TO_HOENN(COMBUSKEN),
-    SPECIES_TO_HOENN(BLAZIKEN),
-    SPECIES_TO_HOENN(MUDKIP),
-    SPECIES_TO_HOENN(MARSHTOMP),
-    SPECIES_TO_HOENN(SWAMPERT),
-    SPECIES_TO_HOENN(POOCHYENA),
-    SPECIES_TO_HOENN(MIGHTYENA),
-    SPECIES_TO_HOENN(ZIGZAGOON),
-    SPECIES_TO_HOENN(LINOONE),
-    SPECIES_TO_HOENN(WURMPLE),
-    SPECIES_TO_HOENN(SILCOON),
-    SPECIES_TO_HOENN(BEAUTIFLY),
-    SPECIES_TO_HOENN(CASCOON),
-    SPECIES_TO_HOENN(DUSTOX),
-    SPECIES_TO_HOENN(LOTAD),
-    SPECIES_TO_HOENN(LOMBRE),
-    SPECIES_TO_HOENN(LUDICOLO),
-    SPECIES_TO_HOENN(SEEDOT),
-    SPECIES_TO_HOENN(NUZLEAF),
-    SPECIES_TO_HOENN(SHIFTRY),
-    SPECIES_TO_HOENN(TAILLOW),
-    SPECIES_TO_HOENN(SWELLOW),
-    SPECIES_TO_HOENN(WINGULL),
-    SPECIES_TO_HOENN(PELIPPER),
-    SPECIES_TO_HOENN(RALTS),
-    SPECIES_TO_HOENN(KIRLIA),
-    SPECIES_TO_HOENN(GARDEVOIR),
-    SPECIES_TO_HOENN(GALLADE),
-    SPECIES_TO_HOENN(SURSKIT),
-    SPECIES_TO_HOENN(MASQUERAIN),
-    SPECIES_TO_HOENN(SHROOMISH),
-    SPECIES_TO_HOENN(BRELOOM),
-    SPECIES_TO_HOENN(SLAKOTH),
-    SPECIES_TO_HOENN(VIGOROTH),
-    SPECIES_TO_HOENN(SLAKING),
-    SPECIES_TO_HOENN(ABRA),
-    SPECIES_TO_HOENN(KADABRA),
-    SPECIES_TO_HOENN(ALAKAZAM),
-    SPECIES_TO_HOENN(NINCADA),
-    SPECIES_TO_HOENN(NINJASK),
-    SPECIES_TO_HOENN(SHEDINJA),
-    SPECIES_TO_HOENN(WHISMUR),
-    SPECIES_TO_HOENN(LOUDRED),
-    SPECIES_TO_HOENN(EXPLOUD),
-    SPECIES_TO_HOENN(MAKUHITA),
-    SPECIES_TO_HOENN(HARIYAMA),
-    SPECIES_TO_HOENN(GOLDEEN),
-    SPECIES_TO_HOENN(SEAKING),
-    SPECIES_TO_HOENN(MAGIKARP),
-    SPECIES_TO_HOENN(GYARADOS),
-    SPECIES_TO_HOENN(AZURILL),
-    SPECIES_TO_HOENN(MARILL),
-    SPECIES_TO_HOENN(AZUMARILL),
-    SPECIES_TO_HOENN(GEODUDE),
-    SPECIES_TO_HOENN(GRAVELER),
-    SPECIES_TO_HOENN(GOLEM),
-    SPECIES_TO_HOENN(NOSEPASS),
-    SPECIES_TO_HOENN(PROBOPASS),
-    SPECIES_TO_HOENN(SKITTY),
-    SPECIES_TO_HOENN(DELCATTY),
-    SPECIES_TO_HOENN(ZUBAT),
-    SPECIES_TO_HOENN(GOLBAT),
-    SPECIES_TO_HOENN(CROBAT),
-    SPECIES_TO_HOENN(TENTACOOL),
-    SPECIES_TO_HOENN(TENTACRUEL),
-    SPECIES_TO_HOENN(SABLEYE),
-    SPECIES_TO_HOENN(MAWILE),
-    SPECIES_TO_HOENN(ARON),
-    SPECIES_TO_HOENN(LAIRON),
-    SPECIES_TO_HOENN(AGGRON),
-    SPECIES_TO_HOENN(MACHOP),
-    SPECIES_TO_HOENN(MACHOKE),
-    SPECIES_TO_HOENN(MACHAMP),
-    SPECIES_TO_HOENN(MEDITITE),
-    SPECIES_TO_HOENN(MEDICHAM),
-    SPECIES_TO_HOENN(ELECTRIKE),
-    SPECIES_TO_HOENN(MANECTRIC),
-    SPECIES_TO_HOENN(PLUSLE),
-    SPECIES_TO_HOENN(MINUN),
-    SPECIES_TO_HOENN(MAGNEMITE),
-    SPECIES_TO_HOENN(MAGNETON),
-    SPECIES_TO_HOENN(MAGNEZONE),
-    SPECIES_TO_HOENN(VOLTORB),
-    SPECIES_TO_HOENN(ELECTRODE),
-    SPECIES_TO_HOENN(VOLBEAT),
-    SPECIES_TO_HOENN(ILLUMISE),
-    SPECIES_TO_HOENN(ODDISH),
-    SPECIES_TO_HOENN(GLOOM),
-    SPECIES_TO_HOENN(VILEPLUME),
-    SPECIES_TO_HOENN(BELLOSSOM),
-    SPECIES_TO_HOENN(DODUO),
-    SPECIES_TO_HOENN(DODRIO),
-    SPECIES_TO_HOENN(BUDEW),
-    SPECIES_TO_HOENN(ROSELIA),
-    SPECIES_TO_HOENN(ROSERADE),
-    SPECIES_TO_HOENN(GULPIN),
-    SPECIES_TO_HOENN(SWALOT),
-    SPECIES_TO_HOENN(CARVANHA),
-    SPECIES_TO_HOENN(SHARPEDO),
-    SPECIES_TO_HOENN(WAILMER),
-    SPECIES_TO_HOENN(WAILORD),
-    SPECIES_TO_HOENN(NUMEL),
-    SPECIES_TO_HOENN(CAMERUPT),
-    SPECIES_TO_HOENN(SLUGMA),
-    SPECIES_TO_HOENN(MAGCARGO),
-    SPECIES_TO_HOENN(TORKOAL),
-    SPECIES_TO_HOENN(GRIMER),
-    SPECIES_TO_HOENN(MUK),
-    SPECIES_TO_HOENN(KOFFING),
-    SPECIES_TO_HOENN(WEEZING),
-    SPECIES_TO_HOENN(SPOINK),
-    SPECIES_TO_HOENN(GRUMPIG),
-    SPECIES_TO_HOENN(SANDSHREW),
-    SPECIES_TO_HOENN(SANDSLASH),
-    SPECIES_TO_HOENN(SPINDA),
-    SPECIES_TO_HOENN(SKARMORY),
-    SPECIES_TO_HOENN(TRAPINCH),
-    SPECIES_TO_HOENN(VIBRAVA),
-    SPECIES_TO_HOENN(FLYGON),
-    SPECIES_TO_HOENN(CACNEA),
-    SPECIES_TO_HOENN(CACTURNE),
-    SPECIES_TO_HOENN(SWABLU),
-    SPECIES_TO_HOENN(ALTARIA),
-    SPECIES_TO_HOENN(ZANGOOSE),
-    SPECIES_TO_HOENN(SEVIPER),
-    SPECIES_TO_HOENN(LUNATONE),
-    SPECIES_TO_HOENN(SOLROCK),
-    SPECIES_TO_HOENN(BARBOACH),
-    SPECIES_TO_HOENN(WHISCASH),
-    SPECIES_TO_HOENN(CORPHISH),
-    SPECIES_TO_HOENN(CRAWDAUNT),
-    SPECIES_TO_HOENN(BALTOY),
-    SPECIES_TO_HOENN(CLAYDOL),
-    SPECIES_TO_HOENN(LILEEP),
-    SPECIES_TO_HOENN(CRADILY),
-    SPECIES_TO_HOENN(ANORITH),
-    SPECIES_TO_HOENN(ARMALDO),
-    SPECIES_TO_HOENN(IGGLYBUFF),
-    SPECIES_TO_HOENN(JIGGLYPUFF),
-    SPECIES_TO_HOENN(WIGGLYTUFF),
-    SPECIES_TO_HOENN(FEEBAS),
-    SPECIES_TO_HOENN(MILOTIC),
-    SPECIES_TO_HOENN(CASTFORM),
-    SPECIES_TO_HOENN(STARYU),
-    SPECIES_TO_HOENN(STARMIE),
-    SPECIES_TO_HOENN(KECLEON),
-    SPECIES_TO_HOENN(SHUPPET),
-    SPECIES_TO_HOENN(BANETTE),
-    SPECIES_TO_HOENN(DUSKULL),
-    SPECIES_TO_HOENN(DUSCLOPS),
-    SPECIES_TO_HOENN(DUSKNOIR),
-    SPECIES_TO_HOENN(TROPIUS),
-    SPECIES_TO_HOENN(CHINGLING),
-    SPECIES_TO_HOENN(CHIMECHO),
-    SPECIES_TO_HOENN(ABSOL),
-    SPECIES_TO_HOENN(VULPIX),
-    SPECIES_TO_HOENN(NINETALES),
-    SPECIES_TO_HOENN(PICHU),
-    SPECIES_TO_HOENN(PIKACHU),
-    SPECIES_TO_HOENN(RAICHU),
-    SPECIES_TO_HOENN(PSYDUCK),
-    SPECIES_TO_HOENN(GOLDUCK),
-    SPECIES_TO_HOENN(WYNAUT),
-    SPECIES_TO_HOENN(WOBBUFFET),
-    SPECIES_TO_HOENN(NATU),
-    SPECIES_TO_HOENN(XATU),
-    SPECIES_TO_HOENN(GIRAFARIG),
-    SPECIES_TO_HOENN(PHANPY),
-    SPECIES_TO_HOENN(DONPHAN),
-    SPECIES_TO_HOENN(PINSIR),
-    SPECIES_TO_HOENN(HERACROSS),
-    SPECIES_TO_HOENN(RHYHORN),
-    SPECIES_TO_HOENN(RHYDON),
-    SPECIES_TO_HOENN(RHYPERIOR),
-    SPECIES_TO_HOENN(SNORUNT),
-    SPECIES_TO_HOENN(GLALIE),
-    SPECIES_TO_HOENN(FROSLASS),
-    SPECIES_TO_HOENN(SPHEAL),
-    SPECIES_TO_HOENN(SEALEO),
-    SPECIES_TO_HOENN(WALREIN),
-    SPECIES_TO_HOENN(CLAMPERL),
-    SPECIES_TO_HOENN(HUNTAIL),
-    SPECIES_TO_HOENN(GOREBYSS),
-    SPECIES_TO_HOENN(RELICANTH),
-    SPECIES_TO_HOENN(CORSOLA),
-    SPECIES_TO_HOENN(CHINCHOU),
-    SPECIES_TO_HOENN(LANTURN),
-    SPECIES_TO_HOENN(LUVDISC),
-    SPECIES_TO_HOENN(HORSEA),
-    SPECIES_TO_HOENN(SEADRA),
-    SPECIES_TO_HOENN(KINGDRA),
-    SPECIES_TO_HOENN(BAGON),
-    SPECIES_TO_HOENN(SHELGON),
-    SPECIES_TO_HOENN(SALAMENCE),
-    SPECIES_TO_HOENN(BELDUM),
-    SPECIES_TO_HOENN(METANG),
-    SPECIES_TO_HOENN(METAGROSS),
-    SPECIES_TO_HOENN(REGIROCK),
-    SPECIES_TO_HOENN(REGICE),
-    SPECIES_TO_HOENN(REGISTEEL),
-    SPECIES_TO_HOENN(LATIAS),
-    SPECIES_TO_HOENN(LATIOS),
-    SPECIES_TO_HOENN(KYOGRE),
-    SPECIES_TO_HOENN(GROUDON),
-    SPECIES_TO_HOENN(RAYQUAZA),
-    SPECIES_TO_HOENN(JIRACHI),
-    SPECIES_TO_HOENN(DEOXYS),
+#include "data/pokemon/species_to_hoenn_dex.h"
 };
 
 const u16 gSpeciesToNationalPokedexNum[NUM_SPECIES] = // Assigns all species to the National Dex Index (Summary No. for National Dex)
 {
-    SPECIES_TO_NATIONAL(BULBASAUR),
-    SPECIES_TO_NATIONAL(IVYSAUR),
-    SPECIES_TO_NATIONAL(VENUSAUR),
-    SPECIES_TO_NATIONAL(CHARMANDER),
-    SPECIES_TO_NATIONAL(CHARMELEON),
-    SPECIES_TO_NATIONAL(CHARIZARD),
-    SPECIES_TO_NATIONAL(SQUIRTLE),
-    SPECIES_TO_NATIONAL(WARTORTLE),
-    SPECIES_TO_NATIONAL(BLASTOISE),
-    SPECIES_TO_NATIONAL(CATERPIE),
-    SPECIES_TO_NATIONAL(METAPOD),
-    SPECIES_TO_NATIONAL(BUTTERFREE),
-    SPECIES_TO_NATIONAL(WEEDLE),
-    SPECIES_TO_NATIONAL(KAKUNA),
-    SPECIES_TO_NATIONAL(BEEDRILL),
-    SPECIES_TO_NATIONAL(PIDGEY),
-    SPECIES_TO_NATIONAL(PIDGEOTTO),
-    SPECIES_TO_NATIONAL(PIDGEOT),
-    SPECIES_TO_NATIONAL(RATTATA),
-    SPECIES_TO_NATIONAL(RATICATE),
-    SPECIES_TO_NATIONAL(SPEAROW),
-    SPECIES_TO_NATIONAL(FEAROW),
-    SPECIES_TO_NATIONAL(EKANS),
-    SPECIES_TO_NATIONAL(ARBOK),
-    SPECIES_TO_NATIONAL(PIKACHU),
-    SPECIES_TO_NATIONAL(RAICHU),
-    SPECIES_TO_NATIONAL(SANDSHREW),
-    SPECIES_TO_NATIONAL(SANDSLASH),
-    SPECIES_TO_NATIONAL(NIDORAN_F),
-    SPECIES_TO_NATIONAL(NIDORINA),
-    SPECIES_TO_NATIONAL(NIDOQUEEN),
-    SPECIES_TO_NATIONAL(NIDORAN_M),
-    SPECIES_TO_NATIONAL(NIDORINO),
-    SPECIES_TO_NATIONAL(NIDOKING),
-    SPECIES_TO_NATIONAL(CLEFAIRY),
-    SPECIES_TO_NATIONAL(CLEFABLE),
-    SPECIES_TO_NATIONAL(VULPIX),
-    SPECIES_TO_NATIONAL(NINETALES),
-    SPECIES_TO_NATIONAL(JIGGLYPUFF),
-    SPECIES_TO_NATIONAL(WIGGLYTUFF),
-    SPECIES_TO_NATIONAL(ZUBAT),
-    SPECIES_TO_NATIONAL(GOLBAT),
-    SPECIES_TO_NATIONAL(ODDISH),
-    SPECIES_TO_NATIONAL(GLOOM),
-    SPECIES_TO_NATIONAL(VILEPLUME),
-    SPECIES_TO_NATIONAL(PARAS),
-    SPECIES_TO_NATIONAL(PARASECT),
-    SPECIES_TO_NATIONAL(VENONAT),
-    SPECIES_TO_NATIONAL(VENOMOTH),
-    SPECIES_TO_NATIONAL(DIGLETT),
-    SPECIES_TO_NATIONAL(DUGTRIO),
-    SPECIES_TO_NATIONAL(MEOWTH),
-    SPECIES_TO_NATIONAL(PERSIAN),
-    SPECIES_TO_NATIONAL(PSYDUCK),
-    SPECIES_TO_NATIONAL(GOLDUCK),
-    SPECIES_TO_NATIONAL(MANKEY),
-    SPECIES_TO_NATIONAL(PRIMEAPE),
-    SPECIES_TO_NATIONAL(GROWLITHE),
-    SPECIES_TO_NATIONAL(ARCANINE),
-    SPECIES_TO_NATIONAL(POLIWAG),
-    SPECIES_TO_NATIONAL(POLIWHIRL),
-    SPECIES_TO_NATIONAL(POLIWRATH),
-    SPECIES_TO_NATIONAL(ABRA),
-    SPECIES_TO_NATIONAL(KADABRA),
-    SPECIES_TO_NATIONAL(ALAKAZAM),
-    SPECIES_TO_NATIONAL(MACHOP),
-    SPECIES_TO_NATIONAL(MACHOKE),
-    SPECIES_TO_NATIONAL(MACHAMP),
-    SPECIES_TO_NATIONAL(BELLSPROUT),
-    SPECIES_TO_NATIONAL(WEEPINBELL),
-    SPECIES_TO_NATIONAL(VICTREEBEL),
-    SPECIES_TO_NATIONAL(TENTACOOL),
-    SPECIES_TO_NATIONAL(TENTACRUEL),
-    SPECIES_TO_NATIONAL(GEODUDE),
-    SPECIES_TO_NATIONAL(GRAVELER),
-    SPECIES_TO_NATIONAL(GOLEM),
-    SPECIES_TO_NATIONAL(PONYTA),
-    SPECIES_TO_NATIONAL(RAPIDASH),
-    SPECIES_TO_NATIONAL(SLOWPOKE),
-    SPECIES_TO_NATIONAL(SLOWBRO),
-    SPECIES_TO_NATIONAL(MAGNEMITE),
-    SPECIES_TO_NATIONAL(MAGNETON),
-    SPECIES_TO_NATIONAL(FARFETCHD),
-    SPECIES_TO_NATIONAL(DODUO),
-    SPECIES_TO_NATIONAL(DODRIO),
-    SPECIES_TO_NATIONAL(SEEL),
-    SPECIES_TO_NATIONAL(DEWGONG),
-    SPECIES_TO_NATIONAL(GRIMER),
-    SPECIES_TO_NATIONAL(MUK),
-    SPECIES_TO_NATIONAL(SHELLDER),
-    SPECIES_TO_NATIONAL(CLOYSTER),
-    SPECIES_TO_NATIONAL(GASTLY),
-    SPECIES_TO_NATIONAL(HAUNTER),
-    SPECIES_TO_NATIONAL(GENGAR),
-    SPECIES_TO_NATIONAL(ONIX),
-    SPECIES_TO_NATIONAL(DROWZEE),
-    SPECIES_TO_NATIONAL(HYPNO),
-    SPECIES_TO_NATIONAL(KRABBY),
-    SPECIES_TO_NATIONAL(KINGLER),
-    SPECIES_TO_NATIONAL(VOLTORB),
-    SPECIES_TO_NATIONAL(ELECTRODE),
-    SPECIES_TO_NATIONAL(EXEGGCUTE),
-    SPECIES_TO_NATIONAL(EXEGGUTOR),
-    SPECIES_TO_NATIONAL(CUBONE),
-    SPECIES_TO_NATIONAL(MAROWAK),
-    SPECIES_TO_NATIONAL(HITMONLEE),
-    SPECIES_TO_NATIONAL(HITMONCHAN),
-    SPECIES_TO_NATIONAL(LICKITUNG),
-    SPECIES_TO_NATIONAL(KOFFING),
-    SPECIES_TO_NATIONAL(WEEZING),
-    SPECIES_TO_NATIONAL(RHYHORN),
-    SPECIES_TO_NATIONAL(RHYDON),
-    SPECIES_TO_NATIONAL(CHANSEY),
-    SPECIES_TO_NATIONAL(TANGELA),
-    SPECIES_TO_NATIONAL(KANGASKHAN),
-    SPECIES_TO_NATIONAL(HORSEA),
-    SPECIES_TO_NATIONAL(SEADRA),
-    SPECIES_TO_NATIONAL(GOLDEEN),
-    SPECIES_TO_NATIONAL(SEAKING),
-    SPECIES_TO_NATIONAL(STARYU),
-    SPECIES_TO_NATIONAL(STARMIE),
-    SPECIES_TO_NATIONAL(MR_MIME),
-    SPECIES_TO_NATIONAL(SCYTHER),
-    SPECIES_TO_NATIONAL(JYNX),
-    SPECIES_TO_NATIONAL(ELECTABUZZ),
-    SPECIES_TO_NATIONAL(MAGMAR),
-    SPECIES_TO_NATIONAL(PINSIR),
-    SPECIES_TO_NATIONAL(TAUROS),
-    SPECIES_TO_NATIONAL(MAGIKARP),
-    SPECIES_TO_NATIONAL(GYARADOS),
-    SPECIES_TO_NATIONAL(LAPRAS),
-    SPECIES_TO_NATIONAL(DITTO),
-    SPECIES_TO_NATIONAL(EEVEE),
-    SPECIES_TO_NATIONAL(VAPOREON),
-    SPECIES_TO_NATIONAL(JOLTEON),
-    SPECIES_TO_NATIONAL(FLAREON),
-    SPECIES_TO_NATIONAL(PORYGON),
-    SPECIES_TO_NATIONAL(OMANYTE),
-    SPECIES_TO_NATIONAL(OMASTAR),
-    SPECIES_TO_NATIONAL(KABUTO),
-    SPECIES_TO_NATIONAL(KABUTOPS),
-    SPECIES_TO_NATIONAL(AERODACTYL),
-    SPECIES_TO_NATIONAL(SNORLAX),
-    SPECIES_TO_NATIONAL(ARTICUNO),
-    SPECIES_TO_NATIONAL(ZAPDOS),
-    SPECIES_TO_NATIONAL(MOLTRES),
-    SPECIES_TO_NATIONAL(DRATINI),
-    SPECIES_TO_NATIONAL(DRAGONAIR),
-    SPECIES_TO_NATIONAL(DRAGONITE),
-    SPECIES_TO_NATIONAL(MEWTWO),
-    SPECIES_TO_NATIONAL(MEW),
-    SPECIES_TO_NATIONAL(CHIKORITA),
-    SPECIES_TO_NATIONAL(BAYLEEF),
-    SPECIES_TO_NATIONAL(MEGANIUM),
-    SPECIES_TO_NATIONAL(CYNDAQUIL),
-    SPECIES_TO_NATIONAL(QUILAVA),
-    SPECIES_TO_NATIONAL(TYPHLOSION),
-    SPECIES_TO_NATIONAL(TOTODILE),
-    SPECIES_TO_NATIONAL(CROCONAW),
-    SPECIES_TO_NATIONAL(FERALIGATR),
-    SPECIES_TO_NATIONAL(SENTRET),
-    SPECIES_TO_NATIONAL(FURRET),
-    SPECIES_TO_NATIONAL(HOOTHOOT),
-    SPECIES_TO_NATIONAL(NOCTOWL),
-    SPECIES_TO_NATIONAL(LEDYBA),
-    SPECIES_TO_NATIONAL(LEDIAN),
-    SPECIES_TO_NATIONAL(SPINARAK),
-    SPECIES_TO_NATIONAL(ARIADOS),
-    SPECIES_TO_NATIONAL(CROBAT),
-    SPECIES_TO_NATIONAL(CHINCHOU),
-    SPECIES_TO_NATIONAL(LANTURN),
-    SPECIES_TO_NATIONAL(PICHU),
-    SPECIES_TO_NATIONAL(CLEFFA),
-    SPECIES_TO_NATIONAL(IGGLYBUFF),
-    SPECIES_TO_NATIONAL(TOGEPI),
-    SPECIES_TO_NATIONAL(TOGETIC),
-    SPECIES_TO_NATIONAL(NATU),
-    SPECIES_TO_NATIONAL(XATU),
-    SPECIES_TO_NATIONAL(MAREEP),
-    SPECIES_TO_NATIONAL(FLAAFFY),
-    SPECIES_TO_NATIONAL(AMPHAROS),
-    SPECIES_TO_NATIONAL(BELLOSSOM),
-    SPECIES_TO_NATIONAL(MARILL),
-    SPECIES_TO_NATIONAL(AZUMARILL),
-    SPECIES_TO_NATIONAL(SUDOWOODO),
-    SPECIES_TO_NATIONAL(POLITOED),
-    SPECIES_TO_NATIONAL(HOPPIP),
-    SPECIES_TO_NATIONAL(SKIPLOOM),
-    SPECIES_TO_NATIONAL(JUMPLUFF),
-    SPECIES_TO_NATIONAL(AIPOM),
-    SPECIES_TO_NATIONAL(SUNKERN),
-    SPECIES_TO_NATIONAL(SUNFLORA),
-    SPECIES_TO_NATIONAL(YANMA),
-    SPECIES_TO_NATIONAL(WOOPER),
-    SPECIES_TO_NATIONAL(QUAGSIRE),
-    SPECIES_TO_NATIONAL(ESPEON),
-    SPECIES_TO_NATIONAL(UMBREON),
-    SPECIES_TO_NATIONAL(MURKROW),
-    SPECIES_TO_NATIONAL(SLOWKING),
-    SPECIES_TO_NATIONAL(MISDREAVUS),
-    SPECIES_TO_NATIONAL(UNOWN),
-    SPECIES_TO_NATIONAL(WOBBUFFET),
-    SPECIES_TO_NATIONAL(GIRAFARIG),
-    SPECIES_TO_NATIONAL(PINECO),
-    SPECIES_TO_NATIONAL(FORRETRESS),
-    SPECIES_TO_NATIONAL(DUNSPARCE),
-    SPECIES_TO_NATIONAL(GLIGAR),
-    SPECIES_TO_NATIONAL(STEELIX),
-    SPECIES_TO_NATIONAL(SNUBBULL),
-    SPECIES_TO_NATIONAL(GRANBULL),
-    SPECIES_TO_NATIONAL(QWILFISH),
-    SPECIES_TO_NATIONAL(SCIZOR),
-    SPECIES_TO_NATIONAL(SHUCKLE),
-    SPECIES_TO_NATIONAL(HERACROSS),
-    SPECIES_TO_NATIONAL(SNEASEL),
-    SPECIES_TO_NATIONAL(TEDDIURSA),
-    SPECIES_TO_NATIONAL(URSARING),
-    SPECIES_TO_NATIONAL(SLUGMA),
-    SPECIES_TO_NATIONAL(MAGCARGO),
-    SPECIES_TO_NATIONAL(SWINUB),
-    SPECIES_TO_NATIONAL(PILOSWINE),
-    SPECIES_TO_NATIONAL(CORSOLA),
-    SPECIES_TO_NATIONAL(REMORAID),
-    SPECIES_TO_NATIONAL(OCTILLERY),
-    SPECIES_TO_NATIONAL(DELIBIRD),
-    SPECIES_TO_NATIONAL(MANTINE),
-    SPECIES_TO_NATIONAL(SKARMORY),
-    SPECIES_TO_NATIONAL(HOUNDOUR),
-    SPECIES_TO_NATIONAL(HOUNDOOM),
-    SPECIES_TO_NATIONAL(KINGDRA),
-    SPECIES_TO_NATIONAL(PHANPY),
-    SPECIES_TO_NATIONAL(DONPHAN),
-    SPECIES_TO_NATIONAL(PORYGON2),
-    SPECIES_TO_NATIONAL(STANTLER),
-    SPECIES_TO_NATIONAL(SMEARGLE),
-    SPECIES_TO_NATIONAL(TYROGUE),
-    SPECIES_TO_NATIONAL(HITMONTOP),
-    SPECIES_TO_NATIONAL(SMOOCHUM),
-    SPECIES_TO_NATIONAL(ELEKID),
-    SPECIES_TO_NATIONAL(MAGBY),
-    SPECIES_TO_NATIONAL(MILTANK),
-    SPECIES_TO_NATIONAL(BLISSEY),
-    SPECIES_TO_NATIONAL(RAIKOU),
-    SPECIES_TO_NATIONAL(ENTEI),
-    SPECIES_TO_NATIONAL(SUICUNE),
-    SPECIES_TO_NATIONAL(LARVITAR),
-    SPECIES_TO_NATIONAL(PUPITAR),
-    SPECIES_TO_NATIONAL(TYRANITAR),
-    SPECIES_TO_NATIONAL(LUGIA),
-    SPECIES_TO_NATIONAL(HO_OH),
-    SPECIES_TO_NATIONAL(CELEBI),
-    SPECIES_TO_NATIONAL(TREECKO),
-    SPECIES_TO_NATIONAL(GROVYLE),
-    SPECIES_TO_NATIONAL(SCEPTILE),
-    SPECIES_TO_NATIONAL(TORCHIC),
-    SPECIES_TO_NATIONAL(COMBUSKEN),
-    SPECIES_TO_NATIONAL(BLAZIKEN),
-    SPECIES_TO_NATIONAL(MUDKIP),
-    SPECIES_TO_NATIONAL(MARSHTOMP),
-    SPECIES_TO_NATIONAL(SWAMPERT),
-    SPECIES_TO_NATIONAL(POOCHYENA),
-    SPECIES_TO_NATIONAL(MIGHTYENA),
-    SPECIES_TO_NATIONAL(ZIGZAGOON),
-    SPECIES_TO_NATIONAL(LINOONE),
-    SPECIES_TO_NATIONAL(WURMPLE),
-    SPECIES_TO_NATIONAL(SILCOON),
-    SPECIES_TO_NATIONAL(BEAUTIFLY),
-    SPECIES_TO_NATIONAL(CASCOON),
-    SPECIES_TO_NATIONAL(DUSTOX),
-    SPECIES_TO_NATIONAL(LOTAD),
-    SPECIES_TO_NATIONAL(LOMBRE),
-    SPECIES_TO_NATIONAL(LUDICOLO),
-    SPECIES_TO_NATIONAL(SEEDOT),
-    SPECIES_TO_NATIONAL(NUZLEAF),
-    SPECIES_TO_NATIONAL(SHIFTRY),
-    SPECIES_TO_NATIONAL(TAILLOW),
-    SPECIES_TO_NATIONAL(SWELLOW),
-    SPECIES_TO_NATIONAL(WINGULL),
-    SPECIES_TO_NATIONAL(PELIPPER),
-    SPECIES_TO_NATIONAL(RALTS),
-    SPECIES_TO_NATIONAL(KIRLIA),
-    SPECIES_TO_NATIONAL(GARDEVOIR),
-    SPECIES_TO_NATIONAL(SURSKIT),
-    SPECIES_TO_NATIONAL(MASQUERAIN),
-    SPECIES_TO_NATIONAL(SHROOMISH),
-    SPECIES_TO_NATIONAL(BRELOOM),
-    SPECIES_TO_NATIONAL(SLAKOTH),
-    SPECIES_TO_NATIONAL(VIGOROTH),
-    SPECIES_TO_NATIONAL(SLAKING),
-    SPECIES_TO_NATIONAL(NINCADA),
-    SPECIES_TO_NATIONAL(NINJASK),
-    SPECIES_TO_NATIONAL(SHEDINJA),
-    SPECIES_TO_NATIONAL(WHISMUR),
-    SPECIES_TO_NATIONAL(LOUDRED),
-    SPECIES_TO_NATIONAL(EXPLOUD),
-    SPECIES_TO_NATIONAL(MAKUHITA),
-    SPECIES_TO_NATIONAL(HARIYAMA),
-    SPECIES_TO_NATIONAL(AZURILL),
-    SPECIES_TO_NATIONAL(NOSEPASS),
-    SPECIES_TO_NATIONAL(SKITTY),
-    SPECIES_TO_NATIONAL(DELCATTY),
-    SPECIES_TO_NATIONAL(SABLEYE),
-    SPECIES_TO_NATIONAL(MAWILE),
-    SPECIES_TO_NATIONAL(ARON),
-    SPECIES_TO_NATIONAL(LAIRON),
-    SPECIES_TO_NATIONAL(AGGRON),
-    SPECIES_TO_NATIONAL(MEDITITE),
-    SPECIES_TO_NATIONAL(MEDICHAM),
-    SPECIES_TO_NATIONAL(ELECTRIKE),
-    SPECIES_TO_NATIONAL(MANECTRIC),
-    SPECIES_TO_NATIONAL(PLUSLE),
-    SPECIES_TO_NATIONAL(MINUN),
-    SPECIES_TO_NATIONAL(VOLBEAT),
-    SPECIES_TO_NATIONAL(ILLUMISE),
-    SPECIES_TO_NATIONAL(ROSELIA),
-    SPECIES_TO_NATIONAL(GULPIN),
-    SPECIES_TO_NATIONAL(SWALOT),
-    SPECIES_TO_NATIONAL(CARVANHA),
-    SPECIES_TO_NATIONAL(SHARPEDO),
-    SPECIES_TO_NATIONAL(WAILMER),
-    SPECIES_TO_NATIONAL(WAILORD),
-    SPECIES_TO_NATIONAL(NUMEL),
-    SPECIES_TO_NATIONAL(CAMERUPT),
-    SPECIES_TO_NATIONAL(TORKOAL),
-    SPECIES_TO_NATIONAL(SPOINK),
-    SPECIES_TO_NATIONAL(GRUMPIG),
-    SPECIES_TO_NATIONAL(SPINDA),
-    SPECIES_TO_NATIONAL(TRAPINCH),
-    SPECIES_TO_NATIONAL(VIBRAVA),
-    SPECIES_TO_NATIONAL(FLYGON),
-    SPECIES_TO_NATIONAL(CACNEA),
-    SPECIES_TO_NATIONAL(CACTURNE),
-    SPECIES_TO_NATIONAL(SWABLU),
-    SPECIES_TO_NATIONAL(ALTARIA),
-    SPECIES_TO_NATIONAL(ZANGOOSE),
-    SPECIES_TO_NATIONAL(SEVIPER),
-    SPECIES_TO_NATIONAL(LUNATONE),
-    SPECIES_TO_NATIONAL(SOLROCK),
-    SPECIES_TO_NATIONAL(BARBOACH),
-    SPECIES_TO_NATIONAL(WHISCASH),
-    SPECIES_TO_NATIONAL(CORPHISH),
-    SPECIES_TO_NATIONAL(CRAWDAUNT),
-    SPECIES_TO_NATIONAL(BALTOY),
-    SPECIES_TO_NATIONAL(CLAYDOL),
-    SPECIES_TO_NATIONAL(LILEEP),
-    SPECIES_TO_NATIONAL(CRADILY),
-    SPECIES_TO_NATIONAL(ANORITH),
-    SPECIES_TO_NATIONAL(ARMALDO),
-    SPECIES_TO_NATIONAL(FEEBAS),
-    SPECIES_TO_NATIONAL(MILOTIC),
-    SPECIES_TO_NATIONAL(CASTFORM),
-    SPECIES_TO_NATIONAL(KECLEON),
-    SPECIES_TO_NATIONAL(SHUPPET),
-    SPECIES_TO_NATIONAL(BANETTE),
-    SPECIES_TO_NATIONAL(DUSKULL),
-    SPECIES_TO_NATIONAL(DUSCLOPS),
-    SPECIES_TO_NATIONAL(TROPIUS),
-    SPECIES_TO_NATIONAL(CHIMECHO),
-    SPECIES_TO_NATIONAL(ABSOL),
-    SPECIES_TO_NATIONAL(WYNAUT),
-    SPECIES_TO_NATIONAL(SNORUNT),
-    SPECIES_TO_NATIONAL(GLALIE),
-    SPECIES_TO_NATIONAL(SPHEAL),
-    SPECIES_TO_NATIONAL(SEALEO),
-    SPECIES_TO_NATIONAL(WALREIN),
-    SPECIES_TO_NATIONAL(CLAMPERL),
-    SPECIES_TO_NATIONAL(HUNTAIL),
-    SPECIES_TO_NATIONAL(GOREBYSS),
-    SPECIES_TO_NATIONAL(RELICANTH),
-    SPECIES_TO_NATIONAL(LUVDISC),
-    SPECIES_TO_NATIONAL(BAGON),
-    SPECIES_TO_NATIONAL(SHELGON),
-    SPECIES_TO_NATIONAL(SALAMENCE),
-    SPECIES_TO_NATIONAL(BELDUM),
-    SPECIES_TO_NATIONAL(METANG),
-    SPECIES_TO_NATIONAL(METAGROSS),
-    SPECIES_TO_NATIONAL(REGIROCK),
-    SPECIES_TO_NATIONAL(REGICE),
-    SPECIES_TO_NATIONAL(REGISTEEL),
-    SPECIES_TO_NATIONAL(LATIAS),
-    SPECIES_TO_NATIONAL(LATIOS),
-    SPECIES_TO_NATIONAL(KYOGRE),
-    SPECIES_TO_NATIONAL(GROUDON),
-    SPECIES_TO_NATIONAL(RAYQUAZA),
-    SPECIES_TO_NATIONAL(JIRACHI),
-    SPECIES_TO_NATIONAL(DEOXYS),
-    SPECIES_TO_NATIONAL(TURTWIG),
-    SPECIES_TO_NATIONAL(GROTLE),
-    SPECIES_TO_NATIONAL(TORTERRA),
-    SPECIES_TO_NATIONAL(CHIMCHAR),
-    SPECIES_TO_NATIONAL(MONFERNO),
-    SPECIES_TO_NATIONAL(INFERNAPE),
-    SPECIES_TO_NATIONAL(PIPLUP),
-    SPECIES_TO_NATIONAL(PRINPLUP),
-    SPECIES_TO_NATIONAL(EMPOLEON),
-    SPECIES_TO_NATIONAL(STARLY),
-    SPECIES_TO_NATIONAL(STARAVIA),
-    SPECIES_TO_NATIONAL(STARAPTOR),
-    SPECIES_TO_NATIONAL(BIDOOF),
-    SPECIES_TO_NATIONAL(BIBAREL),
-    SPECIES_TO_NATIONAL(KRICKETOT),
-    SPECIES_TO_NATIONAL(KRICKETUNE),
-    SPECIES_TO_NATIONAL(SHINX),
-    SPECIES_TO_NATIONAL(LUXIO),
-    SPECIES_TO_NATIONAL(LUXRAY),
-    SPECIES_TO_NATIONAL(BUDEW),
-    SPECIES_TO_NATIONAL(ROSERADE),
-    SPECIES_TO_NATIONAL(CRANIDOS),
-    SPECIES_TO_NATIONAL(RAMPARDOS),
-    SPECIES_TO_NATIONAL(SHIELDON),
-    SPECIES_TO_NATIONAL(BASTIODON),
-    SPECIES_TO_NATIONAL(BURMY),
-    SPECIES_TO_NATIONAL(WORMADAM),
-    SPECIES_TO_NATIONAL(MOTHIM),
-    SPECIES_TO_NATIONAL(COMBEE),
-    SPECIES_TO_NATIONAL(VESPIQUEN),
-    SPECIES_TO_NATIONAL(PACHIRISU),
-    SPECIES_TO_NATIONAL(BUIZEL),
-    SPECIES_TO_NATIONAL(FLOATZEL),
-    SPECIES_TO_NATIONAL(CHERUBI),
-    SPECIES_TO_NATIONAL(CHERRIM),
-    SPECIES_TO_NATIONAL(SHELLOS),
-    SPECIES_TO_NATIONAL(GASTRODON),
-    SPECIES_TO_NATIONAL(AMBIPOM),
-    SPECIES_TO_NATIONAL(DRIFLOON),
-    SPECIES_TO_NATIONAL(DRIFBLIM),
-    SPECIES_TO_NATIONAL(BUNEARY),
-    SPECIES_TO_NATIONAL(LOPUNNY),
-    SPECIES_TO_NATIONAL(MISMAGIUS),
-    SPECIES_TO_NATIONAL(HONCHKROW),
-    SPECIES_TO_NATIONAL(GLAMEOW),
-    SPECIES_TO_NATIONAL(PURUGLY),
-    SPECIES_TO_NATIONAL(CHINGLING),
-    SPECIES_TO_NATIONAL(STUNKY),
-    SPECIES_TO_NATIONAL(SKUNTANK),
-    SPECIES_TO_NATIONAL(BRONZOR),
-    SPECIES_TO_NATIONAL(BRONZONG),
-    SPECIES_TO_NATIONAL(BONSLY),
-    SPECIES_TO_NATIONAL(MIME_JR),
-    SPECIES_TO_NATIONAL(HAPPINY),
-    SPECIES_TO_NATIONAL(CHATOT),
-    SPECIES_TO_NATIONAL(SPIRITOMB),
-    SPECIES_TO_NATIONAL(GIBLE),
-    SPECIES_TO_NATIONAL(GABITE),
-    SPECIES_TO_NATIONAL(GARCHOMP),
-    SPECIES_TO_NATIONAL(MUNCHLAX),
-    SPECIES_TO_NATIONAL(RIOLU),
-    SPECIES_TO_NATIONAL(LUCARIO),
-    SPECIES_TO_NATIONAL(HIPPOPOTAS),
-    SPECIES_TO_NATIONAL(HIPPOWDON),
-    SPECIES_TO_NATIONAL(SKORUPI),
-    SPECIES_TO_NATIONAL(DRAPION),
-    SPECIES_TO_NATIONAL(CROAGUNK),
-    SPECIES_TO_NATIONAL(TOXICROAK),
-    SPECIES_TO_NATIONAL(CARNIVINE),
-    SPECIES_TO_NATIONAL(FINNEON),
-    SPECIES_TO_NATIONAL(LUMINEON),
-    SPECIES_TO_NATIONAL(MANTYKE),
-    SPECIES_TO_NATIONAL(SNOVER),
-    SPECIES_TO_NATIONAL(ABOMASNOW),
-    SPECIES_TO_NATIONAL(WEAVILE),
-    SPECIES_TO_NATIONAL(MAGNEZONE),
-    SPECIES_TO_NATIONAL(LICKILICKY),
-    SPECIES_TO_NATIONAL(RHYPERIOR),
-    SPECIES_TO_NATIONAL(TANGROWTH),
-    SPECIES_TO_NATIONAL(ELECTIVIRE),
-    SPECIES_TO_NATIONAL(MAGMORTAR),
-    SPECIES_TO_NATIONAL(TOGEKISS),
-    SPECIES_TO_NATIONAL(YANMEGA),
-    SPECIES_TO_NATIONAL(LEAFEON),
-    SPECIES_TO_NATIONAL(GLACEON),
-    SPECIES_TO_NATIONAL(GLISCOR),
-    SPECIES_TO_NATIONAL(MAMOSWINE),
-    SPECIES_TO_NATIONAL(PORYGON_Z),
-    SPECIES_TO_NATIONAL(GALLADE),
-    SPECIES_TO_NATIONAL(PROBOPASS),
-    SPECIES_TO_NATIONAL(DUSKNOIR),
-    SPECIES_TO_NATIONAL(FROSLASS),
-    SPECIES_TO_NATIONAL(ROTOM),
-    SPECIES_TO_NATIONAL(UXIE),
-    SPECIES_TO_NATIONAL(MESPRIT),
-    SPECIES_TO_NATIONAL(AZELF),
-    SPECIES_TO_NATIONAL(DIALGA),
-    SPECIES_TO_NATIONAL(PALKIA),
-    SPECIES_TO_NATIONAL(HEATRAN),
-    SPECIES_TO_NATIONAL(REGIGIGAS),
-    SPECIES_TO_NATIONAL(GIRATINA),
-    SPECIES_TO_NATIONAL(CRESSELIA),
-    SPECIES_TO_NATIONAL(PHIONE),
-    SPECIES_TO_NATIONAL(MANAPHY),
-    SPECIES_TO_NATIONAL(DARKRAI),
-    SPECIES_TO_NATIONAL(SHAYMIN),
-    SPECIES_TO_NATIONAL(ARCEUS),
-    SPECIES_TO_NATIONAL(VICTINI),
-    SPECIES_TO_NATIONAL(SNIVY),
-    SPECIES_TO_NATIONAL(SERVINE),
-    SPECIES_TO_NATIONAL(SERPERIOR),
-    SPECIES_TO_NATIONAL(TEPIG),
-    SPECIES_TO_NATIONAL(PIGNITE),
-    SPECIES_TO_NATIONAL(EMBOAR),
-    SPECIES_TO_NATIONAL(OSHAWOTT),
-    SPECIES_TO_NATIONAL(DEWOTT),
-    SPECIES_TO_NATIONAL(SAMUROTT),
-    SPECIES_TO_NATIONAL(PATRAT),
-    SPECIES_TO_NATIONAL(WATCHOG),
-    SPECIES_TO_NATIONAL(LILLIPUP),
-    SPECIES_TO_NATIONAL(HERDIER),
-    SPECIES_TO_NATIONAL(STOUTLAND),
-    SPECIES_TO_NATIONAL(PURRLOIN),
-    SPECIES_TO_NATIONAL(LIEPARD),
-    SPECIES_TO_NATIONAL(PANSAGE),
-    SPECIES_TO_NATIONAL(SIMISAGE),
-    SPECIES_TO_NATIONAL(PANSEAR),
-    SPECIES_TO_NATIONAL(SIMISEAR),
-    SPECIES_TO_NATIONAL(PANPOUR),
-    SPECIES_TO_NATIONAL(SIMIPOUR),
-    SPECIES_TO_NATIONAL(MUNNA),
-    SPECIES_TO_NATIONAL(MUSHARNA),
-    SPECIES_TO_NATIONAL(PIDOVE),
-    SPECIES_TO_NATIONAL(TRANQUILL),
-    SPECIES_TO_NATIONAL(UNFEZANT),
-    SPECIES_TO_NATIONAL(BLITZLE),
-    SPECIES_TO_NATIONAL(ZEBSTRIKA),
-    SPECIES_TO_NATIONAL(ROGGENROLA),
-    SPECIES_TO_NATIONAL(BOLDORE),
-    SPECIES_TO_NATIONAL(GIGALITH),
-    SPECIES_TO_NATIONAL(WOOBAT),
-    SPECIES_TO_NATIONAL(SWOOBAT),
-    SPECIES_TO_NATIONAL(DRILBUR),
-    SPECIES_TO_NATIONAL(EXCADRILL),
-    SPECIES_TO_NATIONAL(AUDINO),
-    SPECIES_TO_NATIONAL(TIMBURR),
-    SPECIES_TO_NATIONAL(GURDURR),
-    SPECIES_TO_NATIONAL(CONKELDURR),
-    SPECIES_TO_NATIONAL(TYMPOLE),
-    SPECIES_TO_NATIONAL(PALPITOAD),
-    SPECIES_TO_NATIONAL(SEISMITOAD),
-    SPECIES_TO_NATIONAL(THROH),
-    SPECIES_TO_NATIONAL(SAWK),
-    SPECIES_TO_NATIONAL(SEWADDLE),
-    SPECIES_TO_NATIONAL(SWADLOON),
-    SPECIES_TO_NATIONAL(LEAVANNY),
-    SPECIES_TO_NATIONAL(VENIPEDE),
-    SPECIES_TO_NATIONAL(WHIRLIPEDE),
-    SPECIES_TO_NATIONAL(SCOLIPEDE),
-    SPECIES_TO_NATIONAL(COTTONEE),
-    SPECIES_TO_NATIONAL(WHIMSICOTT),
-    SPECIES_TO_NATIONAL(PETILIL),
-    SPECIES_TO_NATIONAL(LILLIGANT),
-    SPECIES_TO_NATIONAL(BASCULIN),
-    SPECIES_TO_NATIONAL(SANDILE),
-    SPECIES_TO_NATIONAL(KROKOROK),
-    SPECIES_TO_NATIONAL(KROOKODILE),
-    SPECIES_TO_NATIONAL(DARUMAKA),
-    SPECIES_TO_NATIONAL(DARMANITAN),
-    SPECIES_TO_NATIONAL(MARACTUS),
-    SPECIES_TO_NATIONAL(DWEBBLE),
-    SPECIES_TO_NATIONAL(CRUSTLE),
-    SPECIES_TO_NATIONAL(SCRAGGY),
-    SPECIES_TO_NATIONAL(SCRAFTY),
-    SPECIES_TO_NATIONAL(SIGILYPH),
-    SPECIES_TO_NATIONAL(YAMASK),
-    SPECIES_TO_NATIONAL(COFAGRIGUS),
-    SPECIES_TO_NATIONAL(TIRTOUGA),
-    SPECIES_TO_NATIONAL(CARRACOSTA),
-    SPECIES_TO_NATIONAL(ARCHEN),
-    SPECIES_TO_NATIONAL(ARCHEOPS),
-    SPECIES_TO_NATIONAL(TRUBBISH),
-    SPECIES_TO_NATIONAL(GARBODOR),
-    SPECIES_TO_NATIONAL(ZORUA),
-    SPECIES_TO_NATIONAL(ZOROARK),
-    SPECIES_TO_NATIONAL(MINCCINO),
-    SPECIES_TO_NATIONAL(CINCCINO),
-    SPECIES_TO_NATIONAL(GOTHITA),
-    SPECIES_TO_NATIONAL(GOTHORITA),
-    SPECIES_TO_NATIONAL(GOTHITELLE),
-    SPECIES_TO_NATIONAL(SOLOSIS),
-    SPECIES_TO_NATIONAL(DUOSION),
-    SPECIES_TO_NATIONAL(REUNICLUS),
-    SPECIES_TO_NATIONAL(DUCKLETT),
-    SPECIES_TO_NATIONAL(SWANNA),
-    SPECIES_TO_NATIONAL(VANILLITE),
-    SPECIES_TO_NATIONAL(VANILLISH),
-    SPECIES_TO_NATIONAL(VANILLUXE),
-    SPECIES_TO_NATIONAL(DEERLING),
-    SPECIES_TO_NATIONAL(SAWSBUCK),
-    SPECIES_TO_NATIONAL(EMOLGA),
-    SPECIES_TO_NATIONAL(KARRABLAST),
-    SPECIES_TO_NATIONAL(ESCAVALIER),
-    SPECIES_TO_NATIONAL(FOONGUS),
-    SPECIES_TO_NATIONAL(AMOONGUSS),
-    SPECIES_TO_NATIONAL(FRILLISH),
-    SPECIES_TO_NATIONAL(JELLICENT),
-    SPECIES_TO_NATIONAL(ALOMOMOLA),
-    SPECIES_TO_NATIONAL(JOLTIK),
-    SPECIES_TO_NATIONAL(GALVANTULA),
-    SPECIES_TO_NATIONAL(FERROSEED),
-    SPECIES_TO_NATIONAL(FERROTHORN),
-    SPECIES_TO_NATIONAL(KLINK),
-    SPECIES_TO_NATIONAL(KLANG),
-    SPECIES_TO_NATIONAL(KLINKLANG),
-    SPECIES_TO_NATIONAL(TYNAMO),
-    SPECIES_TO_NATIONAL(EELEKTRIK),
-    SPECIES_TO_NATIONAL(EELEKTROSS),
-    SPECIES_TO_NATIONAL(ELGYEM),
-    SPECIES_TO_NATIONAL(BEHEEYEM),
-    SPECIES_TO_NATIONAL(LITWICK),
-    SPECIES_TO_NATIONAL(LAMPENT),
-    SPECIES_TO_NATIONAL(CHANDELURE),
-    SPECIES_TO_NATIONAL(AXEW),
-    SPECIES_TO_NATIONAL(FRAXURE),
-    SPECIES_TO_NATIONAL(HAXORUS),
-    SPECIES_TO_NATIONAL(CUBCHOO),
-    SPECIES_TO_NATIONAL(BEARTIC),
-    SPECIES_TO_NATIONAL(CRYOGONAL),
-    SPECIES_TO_NATIONAL(SHELMET),
-    SPECIES_TO_NATIONAL(ACCELGOR),
-    SPECIES_TO_NATIONAL(STUNFISK),
-    SPECIES_TO_NATIONAL(MIENFOO),
-    SPECIES_TO_NATIONAL(MIENSHAO),
-    SPECIES_TO_NATIONAL(DRUDDIGON),
-    SPECIES_TO_NATIONAL(GOLETT),
-    SPECIES_TO_NATIONAL(GOLURK),
-    SPECIES_TO_NATIONAL(PAWNIARD),
-    SPECIES_TO_NATIONAL(BISHARP),
-    SPECIES_TO_NATIONAL(BOUFFALANT),
-    SPECIES_TO_NATIONAL(RUFFLET),
-    SPECIES_TO_NATIONAL(BRAVIARY),
-    SPECIES_TO_NATIONAL(VULLABY),
-    SPECIES_TO_NATIONAL(MANDIBUZZ),
-    SPECIES_TO_NATIONAL(HEATMOR),
-    SPECIES_TO_NATIONAL(DURANT),
-    SPECIES_TO_NATIONAL(DEINO),
-    SPECIES_TO_NATIONAL(ZWEILOUS),
-    SPECIES_TO_NATIONAL(HYDREIGON),
-    SPECIES_TO_NATIONAL(LARVESTA),
-    SPECIES_TO_NATIONAL(VOLCARONA),
-    SPECIES_TO_NATIONAL(COBALION),
-    SPECIES_TO_NATIONAL(TERRAKION),
-    SPECIES_TO_NATIONAL(VIRIZION),
-    SPECIES_TO_NATIONAL(TORNADUS),
-    SPECIES_TO_NATIONAL(THUNDURUS),
-    SPECIES_TO_NATIONAL(RESHIRAM),
-    SPECIES_TO_NATIONAL(ZEKROM),
-    SPECIES_TO_NATIONAL(LANDORUS),
-    SPECIES_TO_NATIONAL(KYUREM),
-    SPECIES_TO_NATIONAL(KELDEO),
-    SPECIES_TO_NATIONAL(MELOETTA),
-    SPECIES_TO_NATIONAL(GENESECT),
-    SPECIES_TO_NATIONAL(CHESPIN),
-    SPECIES_TO_NATIONAL(QUILLADIN),
-    SPECIES_TO_NATIONAL(CHESNAUGHT),
-    SPECIES_TO_NATIONAL(FENNEKIN),
-    SPECIES_TO_NATIONAL(BRAIXEN),
-    SPECIES_TO_NATIONAL(DELPHOX),
-    SPECIES_TO_NATIONAL(FROAKIE),
-    SPECIES_TO_NATIONAL(FROGADIER),
-    SPECIES_TO_NATIONAL(GRENINJA),
-    SPECIES_TO_NATIONAL(BUNNELBY),
-    SPECIES_TO_NATIONAL(DIGGERSBY),
-    SPECIES_TO_NATIONAL(FLETCHLING),
-    SPECIES_TO_NATIONAL(FLETCHINDER),
-    SPECIES_TO_NATIONAL(TALONFLAME),
-    SPECIES_TO_NATIONAL(SCATTERBUG),
-    SPECIES_TO_NATIONAL(SPEWPA),
-    SPECIES_TO_NATIONAL(VIVILLON),
-    SPECIES_TO_NATIONAL(LITLEO),
-    SPECIES_TO_NATIONAL(PYROAR),
-    SPECIES_TO_NATIONAL(FLABEBE),
-    SPECIES_TO_NATIONAL(FLOETTE),
-    SPECIES_TO_NATIONAL(FLORGES),
-    SPECIES_TO_NATIONAL(SKIDDO),
-    SPECIES_TO_NATIONAL(GOGOAT),
-    SPECIES_TO_NATIONAL(PANCHAM),
-    SPECIES_TO_NATIONAL(PANGORO),
-    SPECIES_TO_NATIONAL(FURFROU),
-    SPECIES_TO_NATIONAL(ESPURR),
-    SPECIES_TO_NATIONAL(MEOWSTIC),
-    SPECIES_TO_NATIONAL(HONEDGE),
-    SPECIES_TO_NATIONAL(DOUBLADE),
-    SPECIES_TO_NATIONAL(AEGISLASH),
-    SPECIES_TO_NATIONAL(SPRITZEE),
-    SPECIES_TO_NATIONAL(AROMATISSE),
-    SPECIES_TO_NATIONAL(SWIRLIX),
-    SPECIES_TO_NATIONAL(SLURPUFF),
-    SPECIES_TO_NATIONAL(INKAY),
-    SPECIES_TO_NATIONAL(MALAMAR),
-    SPECIES_TO_NATIONAL(BINACLE),
-    SPECIES_TO_NATIONAL(BARBARACLE),
-    SPECIES_TO_NATIONAL(SKRELP),
-    SPECIES_TO_NATIONAL(DRAGALGE),
-    SPECIES_TO_NATIONAL(CLAUNCHER),
-    SPECIES_TO_NATIONAL(CLAWITZER),
-    SPECIES_TO_NATIONAL(HELIOPTILE),
-    SPECIES_TO_NATIONAL(HELIOLISK),
-    SPECIES_TO_NATIONAL(TYRUNT),
-    SPECIES_TO_NATIONAL(TYRANTRUM),
-    SPECIES_TO_NATIONAL(AMAURA),
-    SPECIES_TO_NATIONAL(AURORUS),
-    SPECIES_TO_NATIONAL(SYLVEON),
-    SPECIES_TO_NATIONAL(HAWLUCHA),
-    SPECIES_TO_NATIONAL(DEDENNE),
-    SPECIES_TO_NATIONAL(CARBINK),
-    SPECIES_TO_NATIONAL(GOOMY),
-    SPECIES_TO_NATIONAL(SLIGGOO),
-    SPECIES_TO_NATIONAL(GOODRA),
-    SPECIES_TO_NATIONAL(KLEFKI),
-    SPECIES_TO_NATIONAL(PHANTUMP),
-    SPECIES_TO_NATIONAL(TREVENANT),
-    SPECIES_TO_NATIONAL(PUMPKABOO),
-    SPECIES_TO_NATIONAL(GOURGEIST),
-    SPECIES_TO_NATIONAL(BERGMITE),
-    SPECIES_TO_NATIONAL(AVALUGG),
-    SPECIES_TO_NATIONAL(NOIBAT),
-    SPECIES_TO_NATIONAL(NOIVERN),
-    SPECIES_TO_NATIONAL(XERNEAS),
-    SPECIES_TO_NATIONAL(YVELTAL),
-    SPECIES_TO_NATIONAL(ZYGARDE),
-    SPECIES_TO_NATIONAL(DIANCIE),
-    SPECIES_TO_NATIONAL(HOOPA),
-    SPECIES_TO_NATIONAL(VOLCANION),
-    SPECIES_TO_NATIONAL(ROWLET),
-    SPECIES_TO_NATIONAL(DARTRIX),
-    SPECIES_TO_NATIONAL(DECIDUEYE),
-    SPECIES_TO_NATIONAL(LITTEN),
-    SPECIES_TO_NATIONAL(TORRACAT),
-    SPECIES_TO_NATIONAL(INCINEROAR),
-    SPECIES_TO_NATIONAL(POPPLIO),
-    SPECIES_TO_NATIONAL(BRIONNE),
-    SPECIES_TO_NATIONAL(PRIMARINA),
-    SPECIES_TO_NATIONAL(PIKIPEK),
-    SPECIES_TO_NATIONAL(TRUMBEAK),
-    SPECIES_TO_NATIONAL(TOUCANNON),
-    SPECIES_TO_NATIONAL(YUNGOOS),
-    SPECIES_TO_NATIONAL(GUMSHOOS),
-    SPECIES_TO_NATIONAL(GRUBBIN),
-    SPECIES_TO_NATIONAL(CHARJABUG),
-    SPECIES_TO_NATIONAL(VIKAVOLT),
-    SPECIES_TO_NATIONAL(CRABRAWLER),
-    SPECIES_TO_NATIONAL(CRABOMINABLE),
-    SPECIES_TO_NATIONAL(ORICORIO),
-    SPECIES_TO_NATIONAL(CUTIEFLY),
-    SPECIES_TO_NATIONAL(RIBOMBEE),
-    SPECIES_TO_NATIONAL(ROCKRUFF),
-    SPECIES_TO_NATIONAL(LYCANROC),
-    SPECIES_TO_NATIONAL(WISHIWASHI),
-    SPECIES_TO_NATIONAL(MAREANIE),
-    SPECIES_TO_NATIONAL(TOXAPEX),
-    SPECIES_TO_NATIONAL(MUDBRAY),
-    SPECIES_TO_NATIONAL(MUDSDALE),
-    SPECIES_TO_NATIONAL(DEWPIDER),
-    SPECIES_TO_NATIONAL(ARAQUANID),
-    SPECIES_TO_NATIONAL(FOMANTIS),
-    SPECIES_TO_NATIONAL(LURANTIS),
-    SPECIES_TO_NATIONAL(MORELULL),
-    SPECIES_TO_NATIONAL(SHIINOTIC),
-    SPECIES_TO_NATIONAL(SALANDIT),
-    SPECIES_TO_NATIONAL(SALAZZLE),
-    SPECIES_TO_NATIONAL(STUFFUL),
-    SPECIES_TO_NATIONAL(BEWEAR),
-    SPECIES_TO_NATIONAL(BOUNSWEET),
-    SPECIES_TO_NATIONAL(STEENEE),
-    SPECIES_TO_NATIONAL(TSAREENA),
-    SPECIES_TO_NATIONAL(COMFEY),
-    SPECIES_TO_NATIONAL(ORANGURU),
-    SPECIES_TO_NATIONAL(PASSIMIAN),
-    SPECIES_TO_NATIONAL(WIMPOD),
-    SPECIES_TO_NATIONAL(GOLISOPOD),
-    SPECIES_TO_NATIONAL(SANDYGAST),
-    SPECIES_TO_NATIONAL(PALOSSAND),
-    SPECIES_TO_NATIONAL(PYUKUMUKU),
-    SPECIES_TO_NATIONAL(TYPE_NULL),
-    SPECIES_TO_NATIONAL(SILVALLY),
-    SPECIES_TO_NATIONAL(MINIOR),
-    SPECIES_TO_NATIONAL(KOMALA),
-    SPECIES_TO_NATIONAL(TURTONATOR),
-    SPECIES_TO_NATIONAL(TOGEDEMARU),
-    SPECIES_TO_NATIONAL(MIMIKYU),
-    SPECIES_TO_NATIONAL(BRUXISH),
-    SPECIES_TO_NATIONAL(DRAMPA),
-    SPECIES_TO_NATIONAL(DHELMISE),
-    SPECIES_TO_NATIONAL(JANGMO_O),
-    SPECIES_TO_NATIONAL(HAKAMO_O),
-    SPECIES_TO_NATIONAL(KOMMO_O),
-    SPECIES_TO_NATIONAL(TAPU_KOKO),
-    SPECIES_TO_NATIONAL(TAPU_LELE),
-    SPECIES_TO_NATIONAL(TAPU_BULU),
-    SPECIES_TO_NATIONAL(TAPU_FINI),
-    SPECIES_TO_NATIONAL(COSMOG),
-    SPECIES_TO_NATIONAL(COSMOEM),
-    SPECIES_TO_NATIONAL(SOLGALEO),
-    SPECIES_TO_NATIONAL(LUNALA),
-    SPECIES_TO_NATIONAL(NIHILEGO),
-    SPECIES_TO_NATIONAL(BUZZWOLE),
-    SPECIES_TO_NATIONAL(PHEROMOSA),
-    SPECIES_TO_NATIONAL(XURKITREE),
-    SPECIES_TO_NATIONAL(CELESTEELA),
-    SPECIES_TO_NATIONAL(KARTANA),
-    SPECIES_TO_NATIONAL(GUZZLORD),
-    SPECIES_TO_NATIONAL(NECROZMA),
-    SPECIES_TO_NATIONAL(MAGEARNA),
-    SPECIES_TO_NATIONAL(MARSHADOW),
-    SPECIES_TO_NATIONAL(POIPOLE),
-    SPECIES_TO_NATIONAL(NAGANADEL),
-    SPECIES_TO_NATIONAL(STAKATAKA),
-    SPECIES_TO_NATIONAL(BLACEPHALON),
-    SPECIES_TO_NATIONAL(ZERAORA),
-    SPECIES_TO_NATIONAL(MELTAN),
-    SPECIES_TO_NATIONAL(MELMETAL),
-    SPECIES_TO_NATIONAL(GROOKEY),
-    SPECIES_TO_NATIONAL(THWACKEY),
-    SPECIES_TO_NATIONAL(RILLABOOM),
-    SPECIES_TO_NATIONAL(SCORBUNNY),
-    SPECIES_TO_NATIONAL(RABOOT),
-    SPECIES_TO_NATIONAL(CINDERACE),
-    SPECIES_TO_NATIONAL(SOBBLE),
-    SPECIES_TO_NATIONAL(DRIZZILE),
-    SPECIES_TO_NATIONAL(INTELEON),
-    SPECIES_TO_NATIONAL(SKWOVET),
-    SPECIES_TO_NATIONAL(GREEDENT),
-    SPECIES_TO_NATIONAL(ROOKIDEE),
-    SPECIES_TO_NATIONAL(CORVISQUIRE),
-    SPECIES_TO_NATIONAL(CORVIKNIGHT),
-    SPECIES_TO_NATIONAL(BLIPBUG),
-    SPECIES_TO_NATIONAL(DOTTLER),
-    SPECIES_TO_NATIONAL(ORBEETLE),
-    SPECIES_TO_NATIONAL(NICKIT),
-    SPECIES_TO_NATIONAL(THIEVUL),
-    SPECIES_TO_NATIONAL(GOSSIFLEUR),
-    SPECIES_TO_NATIONAL(ELDEGOSS),
-    SPECIES_TO_NATIONAL(WOOLOO),
-    SPECIES_TO_NATIONAL(DUBWOOL),
-    SPECIES_TO_NATIONAL(CHEWTLE),
-    SPECIES_TO_NATIONAL(DREDNAW),
-    SPECIES_TO_NATIONAL(YAMPER),
-    SPECIES_TO_NATIONAL(BOLTUND),
-    SPECIES_TO_NATIONAL(ROLYCOLY),
-    SPECIES_TO_NATIONAL(CARKOL),
-    SPECIES_TO_NATIONAL(COALOSSAL),
-    SPECIES_TO_NATIONAL(APPLIN),
-    SPECIES_TO_NATIONAL(FLAPPLE),
-    SPECIES_TO_NATIONAL(APPLETUN),
-    SPECIES_TO_NATIONAL(SILICOBRA),
-    SPECIES_TO_NATIONAL(SANDACONDA),
-    SPECIES_TO_NATIONAL(CRAMORANT),
-    SPECIES_TO_NATIONAL(ARROKUDA),
-    SPECIES_TO_NATIONAL(BARRASKEWDA),
-    SPECIES_TO_NATIONAL(TOXEL),
-    SPECIES_TO_NATIONAL(TOXTRICITY),
-    SPECIES_TO_NATIONAL(SIZZLIPEDE),
-    SPECIES_TO_NATIONAL(CENTISKORCH),
-    SPECIES_TO_NATIONAL(CLOBBOPUS),
-    SPECIES_TO_NATIONAL(GRAPPLOCT),
-    SPECIES_TO_NATIONAL(SINISTEA),
-    SPECIES_TO_NATIONAL(POLTEAGEIST),
-    SPECIES_TO_NATIONAL(HATENNA),
-    SPECIES_TO_NATIONAL(HATTREM),
-    SPECIES_TO_NATIONAL(HATTERENE),
-    SPECIES_TO_NATIONAL(IMPIDIMP),
-    SPECIES_TO_NATIONAL(MORGREM),
-    SPECIES_TO_NATIONAL(GRIMMSNARL),
-    SPECIES_TO_NATIONAL(OBSTAGOON),
-    SPECIES_TO_NATIONAL(PERRSERKER),
-    SPECIES_TO_NATIONAL(CURSOLA),
-    SPECIES_TO_NATIONAL(SIRFETCHD),
-    SPECIES_TO_NATIONAL(MR_RIME),
-    SPECIES_TO_NATIONAL(RUNERIGUS),
-    SPECIES_TO_NATIONAL(MILCERY),
-    SPECIES_TO_NATIONAL(ALCREMIE),
-    SPECIES_TO_NATIONAL(FALINKS),
-    SPECIES_TO_NATIONAL(PINCURCHIN),
-    SPECIES_TO_NATIONAL(SNOM),
-    SPECIES_TO_NATIONAL(FROSMOTH),
-    SPECIES_TO_NATIONAL(STONJOURNER),
-    SPECIES_TO_NATIONAL(EISCUE),
-    SPECIES_TO_NATIONAL(INDEEDEE),
-    SPECIES_TO_NATIONAL(MORPEKO),
-    SPECIES_TO_NATIONAL(CUFANT),
-    SPECIES_TO_NATIONAL(COPPERAJAH),
-    SPECIES_TO_NATIONAL(DRACOZOLT),
-    SPECIES_TO_NATIONAL(ARCTOZOLT),
-    SPECIES_TO_NATIONAL(DRACOVISH),
-    SPECIES_TO_NATIONAL(ARCTOVISH),
-    SPECIES_TO_NATIONAL(DURALUDON),
-    SPECIES_TO_NATIONAL(DREEPY),
-    SPECIES_TO_NATIONAL(DRAKLOAK),
-    SPECIES_TO_NATIONAL(DRAGAPULT),
-    SPECIES_TO_NATIONAL(ZACIAN),
-    SPECIES_TO_NATIONAL(ZAMAZENTA),
-    SPECIES_TO_NATIONAL(ETERNATUS),
-    SPECIES_TO_NATIONAL(KUBFU),
-    SPECIES_TO_NATIONAL(URSHIFU),
-    SPECIES_TO_NATIONAL(ZARUDE),
-    SPECIES_TO_NATIONAL(REGIELEKI),
-    SPECIES_TO_NATIONAL(REGIDRAGO),
-    SPECIES_TO_NATIONAL(GLASTRIER),
-    SPECIES_TO_NATIONAL(SPECTRIER),
-    SPECIES_TO_NATIONAL(CALYREX),
-
-    // Megas
-    [SPECIES_VENUSAUR_MEGA - 1] = NATIONAL_DEX_VENUSAUR,
-    [SPECIES_CHARIZARD_MEGA_X - 1] = NATIONAL_DEX_CHARIZARD,
-    [SPECIES_CHARIZARD_MEGA_Y - 1] = NATIONAL_DEX_CHARIZARD,
-    [SPECIES_BLASTOISE_MEGA - 1] = NATIONAL_DEX_BLASTOISE,
-    [SPECIES_BEEDRILL_MEGA - 1] = NATIONAL_DEX_BEEDRILL,
-    [SPECIES_PIDGEOT_MEGA - 1] = NATIONAL_DEX_PIDGEOT,
-    [SPECIES_ALAKAZAM_MEGA - 1] = NATIONAL_DEX_ALAKAZAM,
-    [SPECIES_SLOWBRO_MEGA - 1] = NATIONAL_DEX_SLOWBRO,
-    [SPECIES_GENGAR_MEGA - 1] = NATIONAL_DEX_GENGAR,
-    [SPECIES_KANGASKHAN_MEGA - 1] = NATIONAL_DEX_KANGASKHAN,
-    [SPECIES_PINSIR_MEGA - 1] = NATIONAL_DEX_PINSIR,
-    [SPECIES_GYARADOS_MEGA - 1] = NATIONAL_DEX_GYARADOS,
-    [SPECIES_AERODACTYL_MEGA - 1] = NATIONAL_DEX_AERODACTYL,
-    [SPECIES_MEWTWO_MEGA_X - 1] = NATIONAL_DEX_MEWTWO,
-    [SPECIES_MEWTWO_MEGA_Y - 1] = NATIONAL_DEX_MEWTWO,
-    [SPECIES_AMPHAROS_MEGA - 1] = NATIONAL_DEX_AMPHAROS,
-    [SPECIES_STEELIX_MEGA - 1] = NATIONAL_DEX_STEELIX,
-    [SPECIES_SCIZOR_MEGA - 1] = NATIONAL_DEX_SCIZOR,
-    [SPECIES_HERACROSS_MEGA - 1] = NATIONAL_DEX_HERACROSS,
-    [SPECIES_HOUNDOOM_MEGA - 1] = NATIONAL_DEX_HOUNDOOM,
-    [SPECIES_TYRANITAR_MEGA - 1] = NATIONAL_DEX_TYRANITAR,
-    [SPECIES_SCEPTILE_MEGA - 1] = NATIONAL_DEX_SCEPTILE,
-    [SPECIES_BLAZIKEN_MEGA - 1] = NATIONAL_DEX_BLAZIKEN,
-    [SPECIES_SWAMPERT_MEGA - 1] = NATIONAL_DEX_SWAMPERT,
-    [SPECIES_GARDEVOIR_MEGA - 1] = NATIONAL_DEX_GARDEVOIR,
-    [SPECIES_SABLEYE_MEGA - 1] = NATIONAL_DEX_SABLEYE,
-    [SPECIES_MAWILE_MEGA - 1] = NATIONAL_DEX_MAWILE,
-    [SPECIES_AGGRON_MEGA - 1] = NATIONAL_DEX_AGGRON,
-    [SPECIES_MEDICHAM_MEGA - 1] = NATIONAL_DEX_MEDICHAM,
-    [SPECIES_MANECTRIC_MEGA - 1] = NATIONAL_DEX_MANECTRIC,
-    [SPECIES_SHARPEDO_MEGA - 1] = NATIONAL_DEX_SHARPEDO,
-    [SPECIES_CAMERUPT_MEGA - 1] = NATIONAL_DEX_CAMERUPT,
-    [SPECIES_ALTARIA_MEGA - 1] = NATIONAL_DEX_ALTARIA,
-    [SPECIES_BANETTE_MEGA - 1] = NATIONAL_DEX_BANETTE,
-    [SPECIES_ABSOL_MEGA - 1] = NATIONAL_DEX_ABSOL,
-    [SPECIES_GLALIE_MEGA - 1] = NATIONAL_DEX_GLALIE,
-    [SPECIES_SALAMENCE_MEGA - 1] = NATIONAL_DEX_SALAMENCE,
-    [SPECIES_METAGROSS_MEGA - 1] = NATIONAL_DEX_METAGROSS,
-    [SPECIES_LATIAS_MEGA - 1] = NATIONAL_DEX_LATIAS,
-    [SPECIES_LATIOS_MEGA - 1] = NATIONAL_DEX_LATIOS,
-    [SPECIES_LOPUNNY_MEGA - 1] = NATIONAL_DEX_LOPUNNY,
-    [SPECIES_GARCHOMP_MEGA - 1] = NATIONAL_DEX_GARCHOMP,
-    [SPECIES_LUCARIO_MEGA - 1] = NATIONAL_DEX_LUCARIO,
-    [SPECIES_ABOMASNOW_MEGA - 1] = NATIONAL_DEX_ABOMASNOW,
-    [SPECIES_GALLADE_MEGA - 1] = NATIONAL_DEX_GALLADE,
-    [SPECIES_AUDINO_MEGA - 1] = NATIONAL_DEX_AUDINO,
-    [SPECIES_DIANCIE_MEGA - 1] = NATIONAL_DEX_DIANCIE,
-    [SPECIES_MILOTIC_MEGA - 1] = NATIONAL_DEX_MILOTIC,
-    [SPECIES_BUTTERFREE_MEGA - 1] = NATIONAL_DEX_BUTTERFREE,
-    [SPECIES_MACHAMP_MEGA - 1] = NATIONAL_DEX_MACHAMP,
-    [SPECIES_KINGLER_MEGA - 1] = NATIONAL_DEX_KINGLER,
-    [SPECIES_LAPRAS_MEGA - 1] = NATIONAL_DEX_LAPRAS,
-    [SPECIES_FLYGON_MEGA - 1] = NATIONAL_DEX_FLYGON,
-    [SPECIES_KINGDRA_MEGA - 1] = NATIONAL_DEX_KINGDRA,
-    // Special Mega + Primals
-    [SPECIES_RAYQUAZA_MEGA - 1] = NATIONAL_DEX_RAYQUAZA,
-    [SPECIES_KYOGRE_PRIMAL - 1] = NATIONAL_DEX_KYOGRE,
-    [SPECIES_GROUDON_PRIMAL - 1] = NATIONAL_DEX_GROUDON,
-    // Alolan Forms
-    [SPECIES_RATTATA_ALOLAN - 1] = NATIONAL_DEX_RATTATA,
-    [SPECIES_RATICATE_ALOLAN - 1] = NATIONAL_DEX_RATICATE,
-    [SPECIES_RAICHU_ALOLAN - 1] = NATIONAL_DEX_RAICHU,
-    [SPECIES_SANDSHREW_ALOLAN - 1] = NATIONAL_DEX_SANDSHREW,
-    [SPECIES_SANDSLASH_ALOLAN - 1] = NATIONAL_DEX_SANDSLASH,
-    [SPECIES_VULPIX_ALOLAN - 1] = NATIONAL_DEX_VULPIX,
-    [SPECIES_NINETALES_ALOLAN - 1] = NATIONAL_DEX_NINETALES,
-    [SPECIES_DIGLETT_ALOLAN - 1] = NATIONAL_DEX_DIGLETT,
-    [SPECIES_DUGTRIO_ALOLAN - 1] = NATIONAL_DEX_DUGTRIO,
-    [SPECIES_MEOWTH_ALOLAN - 1] = NATIONAL_DEX_MEOWTH,
-    [SPECIES_PERSIAN_ALOLAN - 1] = NATIONAL_DEX_PERSIAN,
-    [SPECIES_GEODUDE_ALOLAN - 1] = NATIONAL_DEX_GEODUDE,
-    [SPECIES_GRAVELER_ALOLAN - 1] = NATIONAL_DEX_GRAVELER,
-    [SPECIES_GOLEM_ALOLAN - 1] = NATIONAL_DEX_GOLEM,
-    [SPECIES_GRIMER_ALOLAN - 1] = NATIONAL_DEX_GRIMER,
-    [SPECIES_MUK_ALOLAN - 1] = NATIONAL_DEX_MUK,
-    [SPECIES_EXEGGUTOR_ALOLAN - 1] = NATIONAL_DEX_EXEGGUTOR,
-    [SPECIES_MAROWAK_ALOLAN - 1] = NATIONAL_DEX_MAROWAK,
-    // Galarian Forms
-    [SPECIES_MEOWTH_GALARIAN - 1] = NATIONAL_DEX_MEOWTH,
-    [SPECIES_PONYTA_GALARIAN - 1] = NATIONAL_DEX_PONYTA,
-    [SPECIES_RAPIDASH_GALARIAN - 1] = NATIONAL_DEX_RAPIDASH,
-    [SPECIES_SLOWPOKE_GALARIAN - 1] = NATIONAL_DEX_SLOWPOKE,
-    [SPECIES_SLOWBRO_GALARIAN - 1] = NATIONAL_DEX_SLOWBRO,
-    [SPECIES_FARFETCHD_GALARIAN - 1] = NATIONAL_DEX_FARFETCHD,
-    [SPECIES_WEEZING_GALARIAN - 1] = NATIONAL_DEX_WEEZING,
-    [SPECIES_MR_MIME_GALARIAN - 1] = NATIONAL_DEX_MR_MIME,
-    [SPECIES_ARTICUNO_GALARIAN - 1] = NATIONAL_DEX_ARTICUNO,
-    [SPECIES_ZAPDOS_GALARIAN - 1] = NATIONAL_DEX_ZAPDOS,
-    [SPECIES_MOLTRES_GALARIAN - 1] = NATIONAL_DEX_MOLTRES,
-    [SPECIES_SLOWKING_GALARIAN - 1] = NATIONAL_DEX_SLOWKING,
-    [SPECIES_CORSOLA_GALARIAN - 1] = NATIONAL_DEX_CORSOLA,
-    [SPECIES_ZIGZAGOON_GALARIAN - 1] = NATIONAL_DEX_ZIGZAGOON,
-    [SPECIES_LINOONE_GALARIAN - 1] = NATIONAL_DEX_LINOONE,
-    [SPECIES_DARUMAKA_GALARIAN - 1] = NATIONAL_DEX_DARUMAKA,
-    [SPECIES_DARMANITAN_GALARIAN - 1] = NATIONAL_DEX_DARMANITAN,
-    [SPECIES_YAMASK_GALARIAN - 1] = NATIONAL_DEX_YAMASK,
-    [SPECIES_STUNFISK_GALARIAN - 1] = NATIONAL_DEX_STUNFISK,
-    // Cosplay Pikachu
-    [SPECIES_PIKACHU_COSPLAY - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_ROCK_STAR - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_BELLE - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_POP_STAR - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_PH_D - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_LIBRE - 1] = NATIONAL_DEX_PIKACHU,
-    // Cap Pikachu
-    [SPECIES_PIKACHU_ORIGINAL_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_HOENN_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_SINNOH_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_UNOVA_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_KALOS_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_ALOLA_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_PARTNER_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    [SPECIES_PIKACHU_WORLD_CAP - 1] = NATIONAL_DEX_PIKACHU,
-    // Pichu
-    [SPECIES_PICHU_SPIKY_EARED - 1] = NATIONAL_DEX_PICHU,
-    // Unown
-    [SPECIES_UNOWN_B - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_C - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_D - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_E - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_F - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_G - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_H - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_I - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_J - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_K - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_L - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_M - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_N - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_O - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_P - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_Q - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_R - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_S - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_T - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_U - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_V - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_W - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_X - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_Y - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_Z - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_QMARK - 1] = NATIONAL_DEX_UNOWN,
-    [SPECIES_UNOWN_EMARK - 1] = NATIONAL_DEX_UNOWN,
-    // Castform
-    [SPECIES_CASTFORM_SUNNY - 1] = NATIONAL_DEX_CASTFORM,
-    [SPECIES_CASTFORM_RAINY - 1] = NATIONAL_DEX_CASTFORM,
-    [SPECIES_CASTFORM_SNOWY - 1] = NATIONAL_DEX_CASTFORM,
-    // Deoxys
-    [SPECIES_DEOXYS_ATTACK - 1] = NATIONAL_DEX_DEOXYS,
-    [SPECIES_DEOXYS_DEFENSE - 1] = NATIONAL_DEX_DEOXYS,
-    [SPECIES_DEOXYS_SPEED - 1] = NATIONAL_DEX_DEOXYS,
-    // Burmy
-    [SPECIES_BURMY_SANDY_CLOAK - 1] = NATIONAL_DEX_BURMY,
-    [SPECIES_BURMY_TRASH_CLOAK - 1] = NATIONAL_DEX_BURMY,
-    // Wormadam
-    [SPECIES_WORMADAM_SANDY_CLOAK - 1] = NATIONAL_DEX_WORMADAM,
-    [SPECIES_WORMADAM_TRASH_CLOAK - 1] = NATIONAL_DEX_WORMADAM,
-    // Cherrim
-    [SPECIES_CHERRIM_SUNSHINE - 1] = NATIONAL_DEX_CHERRIM,
-    // Shellos
-    [SPECIES_SHELLOS_EAST_SEA - 1] = NATIONAL_DEX_SHELLOS,
-    // Gastrodon
-    [SPECIES_GASTRODON_EAST_SEA - 1] = NATIONAL_DEX_GASTRODON,
-    // Rotom
-    [SPECIES_ROTOM_HEAT - 1] = NATIONAL_DEX_ROTOM,
-    [SPECIES_ROTOM_WASH - 1] = NATIONAL_DEX_ROTOM,
-    [SPECIES_ROTOM_FROST - 1] = NATIONAL_DEX_ROTOM,
-    [SPECIES_ROTOM_FAN - 1] = NATIONAL_DEX_ROTOM,
-    [SPECIES_ROTOM_MOW - 1] = NATIONAL_DEX_ROTOM,
-    // Giratina
-    [SPECIES_GIRATINA_ORIGIN - 1] = NATIONAL_DEX_GIRATINA,
-    // Shaymin
-    [SPECIES_SHAYMIN_SKY - 1] = NATIONAL_DEX_SHAYMIN,
-    // Arceus
-    [SPECIES_ARCEUS_FIGHTING - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_FLYING - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_POISON - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_GROUND - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_ROCK - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_BUG - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_GHOST - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_STEEL - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_FIRE - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_WATER - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_GRASS - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_ELECTRIC - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_PSYCHIC - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_ICE - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_DRAGON - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_DARK - 1] = NATIONAL_DEX_ARCEUS,
-    [SPECIES_ARCEUS_FAIRY - 1] = NATIONAL_DEX_ARCEUS,
-    // Basculin
-    [SPECIES_BASCULIN_BLUE_STRIPED - 1] = NATIONAL_DEX_BASCULIN,
-    // Darmanitan
-    [SPECIES_DARMANITAN_ZEN_MODE - 1] = NATIONAL_DEX_DARMANITAN,
-    [SPECIES_DARMANITAN_ZEN_MODE_GALARIAN - 1] = NATIONAL_DEX_DARMANITAN,
-    // Deerling
-    [SPECIES_DEERLING_SUMMER - 1] = NATIONAL_DEX_DEERLING,
-    [SPECIES_DEERLING_AUTUMN - 1] = NATIONAL_DEX_DEERLING,
-    [SPECIES_DEERLING_WINTER - 1] = NATIONAL_DEX_DEERLING,
-    // Sawsbuck
-    [SPECIES_SAWSBUCK_SUMMER - 1] = NATIONAL_DEX_SAWSBUCK,
-    [SPECIES_SAWSBUCK_AUTUMN - 1] = NATIONAL_DEX_SAWSBUCK,
-    [SPECIES_SAWSBUCK_WINTER - 1] = NATIONAL_DEX_SAWSBUCK,
-    // Therian Forms
-    [SPECIES_TORNADUS_THERIAN - 1] = NATIONAL_DEX_TORNADUS,
-    [SPECIES_THUNDURUS_THERIAN - 1] = NATIONAL_DEX_THUNDURUS,
-    [SPECIES_LANDORUS_THERIAN - 1] = NATIONAL_DEX_LANDORUS,
-    // Kyurem
-    [SPECIES_KYUREM_BLACK - 1] = NATIONAL_DEX_KYUREM,
-    [SPECIES_KYUREM_WHITE - 1] = NATIONAL_DEX_KYUREM,
-    // Keldeo
-    [SPECIES_KELDEO_RESOLUTE - 1] = NATIONAL_DEX_KELDEO,
-    // Meloetta
-    [SPECIES_MELOETTA_PIROUETTE - 1] = NATIONAL_DEX_MELOETTA,
-    // Genesect
-    [SPECIES_GENESECT_DOUSE_DRIVE - 1] = NATIONAL_DEX_GENESECT,
-    [SPECIES_GENESECT_SHOCK_DRIVE - 1] = NATIONAL_DEX_GENESECT,
-    [SPECIES_GENESECT_BURN_DRIVE - 1] = NATIONAL_DEX_GENESECT,
-    [SPECIES_GENESECT_CHILL_DRIVE - 1] = NATIONAL_DEX_GENESECT,
-    // Greninja
-    [SPECIES_GRENINJA_BATTLE_BOND - 1] = NATIONAL_DEX_GRENINJA,
-    [SPECIES_GRENINJA_ASH - 1] = NATIONAL_DEX_GRENINJA,
-    // Vivillon
-    [SPECIES_VIVILLON_POLAR - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_TUNDRA - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_CONTINENTAL - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_GARDEN - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_ELEGANT - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_MEADOW - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_MODERN - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_MARINE - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_ARCHIPELAGO - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_HIGH_PLAINS - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_SANDSTORM - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_RIVER - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_MONSOON - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_SAVANNA - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_SUN - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_OCEAN - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_JUNGLE - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_FANCY - 1] = NATIONAL_DEX_VIVILLON,
-    [SPECIES_VIVILLON_POKE_BALL - 1] = NATIONAL_DEX_VIVILLON,
-    // Flabébé
-    [SPECIES_FLABEBE_YELLOW_FLOWER - 1] = NATIONAL_DEX_FLABEBE,
-    [SPECIES_FLABEBE_ORANGE_FLOWER - 1] = NATIONAL_DEX_FLABEBE,
-    [SPECIES_FLABEBE_BLUE_FLOWER - 1] = NATIONAL_DEX_FLABEBE,
-    [SPECIES_FLABEBE_WHITE_FLOWER - 1] = NATIONAL_DEX_FLABEBE,
-    // Floette
-    [SPECIES_FLOETTE_YELLOW_FLOWER - 1] = NATIONAL_DEX_FLOETTE,
-    [SPECIES_FLOETTE_ORANGE_FLOWER - 1] = NATIONAL_DEX_FLOETTE,
-    [SPECIES_FLOETTE_BLUE_FLOWER - 1] = NATIONAL_DEX_FLOETTE,
-    [SPECIES_FLOETTE_WHITE_FLOWER - 1] = NATIONAL_DEX_FLOETTE,
-    [SPECIES_FLOETTE_ETERNAL_FLOWER - 1] = NATIONAL_DEX_FLOETTE,
-    // Florges
-    [SPECIES_FLORGES_YELLOW_FLOWER - 1] = NATIONAL_DEX_FLORGES,
-    [SPECIES_FLORGES_ORANGE_FLOWER - 1] = NATIONAL_DEX_FLORGES,
-    [SPECIES_FLORGES_BLUE_FLOWER - 1] = NATIONAL_DEX_FLORGES,
-    [SPECIES_FLORGES_WHITE_FLOWER - 1] = NATIONAL_DEX_FLORGES,
-    // Furfrou
-    [SPECIES_FURFROU_HEART_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_STAR_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_DIAMOND_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_DEBUTANTE_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_MATRON_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_DANDY_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_LA_REINE_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_KABUKI_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    [SPECIES_FURFROU_PHARAOH_TRIM - 1] = NATIONAL_DEX_FURFROU,
-    // Meowstic
-    [SPECIES_MEOWSTIC_FEMALE - 1] = NATIONAL_DEX_MEOWSTIC,
-    // Aegislash
-    [SPECIES_AEGISLASH_BLADE - 1] = NATIONAL_DEX_AEGISLASH,
-    // Pumpkaboo
-    [SPECIES_PUMPKABOO_SMALL - 1] = NATIONAL_DEX_PUMPKABOO,
-    [SPECIES_PUMPKABOO_LARGE - 1] = NATIONAL_DEX_PUMPKABOO,
-    [SPECIES_PUMPKABOO_SUPER - 1] = NATIONAL_DEX_PUMPKABOO,
-    // Gourgeist
-    [SPECIES_GOURGEIST_SMALL - 1] = NATIONAL_DEX_GOURGEIST,
-    [SPECIES_GOURGEIST_LARGE - 1] = NATIONAL_DEX_GOURGEIST,
-    [SPECIES_GOURGEIST_SUPER - 1] = NATIONAL_DEX_GOURGEIST,
-    // Xerneas
-    [SPECIES_XERNEAS_ACTIVE - 1] = NATIONAL_DEX_XERNEAS,
-    // Zygarde
-    [SPECIES_ZYGARDE_10 - 1] = NATIONAL_DEX_ZYGARDE,
-    [SPECIES_ZYGARDE_10_POWER_CONSTRUCT - 1] = NATIONAL_DEX_ZYGARDE,
-    [SPECIES_ZYGARDE_50_POWER_CONSTRUCT - 1] = NATIONAL_DEX_ZYGARDE,
-    [SPECIES_ZYGARDE_COMPLETE - 1] = NATIONAL_DEX_ZYGARDE,
-    // Hoopa
-    [SPECIES_HOOPA_UNBOUND - 1] = NATIONAL_DEX_HOOPA,
-    // Oricorio
-    [SPECIES_ORICORIO_POM_POM - 1] = NATIONAL_DEX_ORICORIO,
-    [SPECIES_ORICORIO_PAU - 1] = NATIONAL_DEX_ORICORIO,
-    [SPECIES_ORICORIO_SENSU - 1] = NATIONAL_DEX_ORICORIO,
-    // Rockruff
-    [SPECIES_ROCKRUFF_OWN_TEMPO - 1] = NATIONAL_DEX_ROCKRUFF,
-    // Lycanroc
-    [SPECIES_LYCANROC_MIDNIGHT - 1] = NATIONAL_DEX_LYCANROC,
-    [SPECIES_LYCANROC_DUSK - 1] = NATIONAL_DEX_LYCANROC,
-    // Wishiwashi
-    [SPECIES_WISHIWASHI_SCHOOL - 1] = NATIONAL_DEX_WISHIWASHI,
-    // Silvally
-    [SPECIES_SILVALLY_FIGHTING - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_FLYING - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_POISON - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_GROUND - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_ROCK - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_BUG - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_GHOST - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_STEEL - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_FIRE - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_WATER - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_GRASS - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_ELECTRIC - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_PSYCHIC - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_ICE - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_DRAGON - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_DARK - 1] = NATIONAL_DEX_SILVALLY,
-    [SPECIES_SILVALLY_FAIRY - 1] = NATIONAL_DEX_SILVALLY,
-    // Minior
-    [SPECIES_MINIOR_METEOR_ORANGE - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_METEOR_YELLOW - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_METEOR_GREEN - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_METEOR_BLUE - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_METEOR_INDIGO - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_METEOR_VIOLET - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_CORE_RED - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_CORE_ORANGE - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_CORE_YELLOW - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_CORE_GREEN - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_CORE_BLUE - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_CORE_INDIGO - 1] = NATIONAL_DEX_MINIOR,
-    [SPECIES_MINIOR_CORE_VIOLET - 1] = NATIONAL_DEX_MINIOR,
-    // Mimikyu
-    [SPECIES_MIMIKYU_BUSTED - 1] = NATIONAL_DEX_MIMIKYU,
-    // Necrozma
-    [SPECIES_NECROZMA_DUSK_MANE - 1] = NATIONAL_DEX_NECROZMA,
-    [SPECIES_NECROZMA_DAWN_WINGS - 1] = NATIONAL_DEX_NECROZMA,
-    [SPECIES_NECROZMA_ULTRA - 1] = NATIONAL_DEX_NECROZMA,
-    // Magearna
-    [SPECIES_MAGEARNA_ORIGINAL_COLOR - 1] = NATIONAL_DEX_MAGEARNA,
-    // Cramorant
-    [SPECIES_CRAMORANT_GULPING - 1] = NATIONAL_DEX_CRAMORANT,
-    [SPECIES_CRAMORANT_GORGING - 1] = NATIONAL_DEX_CRAMORANT,
-    // Toxtricity
-    [SPECIES_TOXTRICITY_LOW_KEY - 1] = NATIONAL_DEX_TOXTRICITY,
-    // Sinistea
-    [SPECIES_SINISTEA_ANTIQUE - 1] = NATIONAL_DEX_SINISTEA,
-    // Polteageist
-    [SPECIES_POLTEAGEIST_ANTIQUE - 1] = NATIONAL_DEX_POLTEAGEIST,
-    // Alcremie
-    [SPECIES_ALCREMIE_RUBY_CREAM - 1] = NATIONAL_DEX_ALCREMIE,
-    [SPECIES_ALCREMIE_MATCHA_CREAM - 1] = NATIONAL_DEX_ALCREMIE,
-    [SPECIES_ALCREMIE_MINT_CREAM - 1] = NATIONAL_DEX_ALCREMIE,
-    [SPECIES_ALCREMIE_LEMON_CREAM - 1] = NATIONAL_DEX_ALCREMIE,
-    [SPECIES_ALCREMIE_SALTED_CREAM - 1] = NATIONAL_DEX_ALCREMIE,
-    [SPECIES_ALCREMIE_RUBY_SWIRL - 1] = NATIONAL_DEX_ALCREMIE,
-    [SPECIES_ALCREMIE_CARAMEL_SWIRL - 1] = NATIONAL_DEX_ALCREMIE,
-    [SPECIES_ALCREMIE_RAINBOW_SWIRL - 1] = NATIONAL_DEX_ALCREMIE,
-    // Eiscue
-    [SPECIES_EISCUE_NOICE_FACE - 1] = NATIONAL_DEX_EISCUE,
-    // Indeedee
-    [SPECIES_INDEEDEE_FEMALE - 1] = NATIONAL_DEX_INDEEDEE,
-    // Morpeko
-    [SPECIES_MORPEKO_HANGRY - 1] = NATIONAL_DEX_MORPEKO,
-    // Zacian
-    [SPECIES_ZACIAN_CROWNED_SWORD - 1] = NATIONAL_DEX_ZACIAN,
-    // Zamazenta
-    [SPECIES_ZAMAZENTA_CROWNED_SHIELD - 1] = NATIONAL_DEX_ZAMAZENTA,
-    // Eternatus
-    [SPECIES_ETERNATUS_ETERNAMAX - 1] = NATIONAL_DEX_ETERNATUS,
-    // Urshifu
-    [SPECIES_URSHIFU_RAPID_STRIKE_STYLE - 1] = NATIONAL_DEX_URSHIFU,
-    // Zarude
-    [SPECIES_ZARUDE_DADA - 1] = NATIONAL_DEX_ZARUDE,
-    // Calyrex
-    [SPECIES_CALYREX_ICE_RIDER - 1] = NATIONAL_DEX_CALYREX,
-    [SPECIES_CALYREX_SHADOW_RIDER - 1] = NATIONAL_DEX_CALYREX,
+#include "data/pokemon/species_to_national_dex.h"
+#include "data/pokemon/form_species_to_national_dex.h"
 };
 
 const u16 gHoennToNationalOrder[HOENN_DEX_COUNT] = // Assigns Hoenn Dex Pokémon (Using National Dex Index)
 {
-    HOENN_TO_NATIONAL(TREECKO),
-    HOENN_TO_NATIONAL(GROVYLE),
-    HOENN_TO_NATIONAL(SCEPTILE),
-    HOENN_TO_NATIONAL(TORCHIC),
-    HOENN_TO_NATIONAL(COMBUSKEN),
-    HOENN_TO_NATIONAL(BLAZIKEN),
-    HOENN_TO_NATIONAL(MUDKIP),
-    HOENN_TO_NATIONAL(MARSHTOMP),
-    HOENN_TO_NATIONAL(SWAMPERT),
-    HOENN_TO_NATIONAL(POOCHYENA),
-    HOENN_TO_NATIONAL(MIGHTYENA),
-    HOENN_TO_NATIONAL(ZIGZAGOON),
-    HOENN_TO_NATIONAL(LINOONE),
-    HOENN_TO_NATIONAL(WURMPLE),
-    HOENN_TO_NATIONAL(SILCOON),
-    HOENN_TO_NATIONAL(BEAUTIFLY),
-    HOENN_TO_NATIONAL(CASCOON),
-    HOENN_TO_NATIONAL(DUSTOX),
-    HOENN_TO_NATIONAL(LOTAD),
-    HOENN_TO_NATIONAL(LOMBRE),
-    HOENN_TO_NATIONAL(LUDICOLO),
-    HOENN_TO_NATIONAL(SEEDOT),
-    HOENN_TO_NATIONAL(NUZLEAF),
-    HOENN_TO_NATIONAL(SHIFTRY),
-    HOENN_TO_NATIONAL(TAILLOW),
-    HOENN_TO_NATIONAL(SWELLOW),
-    HOENN_TO_NATIONAL(WINGULL),
-    HOENN_TO_NATIONAL(PELIPPER),
-    HOENN_TO_NATIONAL(RALTS),
-    HOENN_TO_NATIONAL(KIRLIA),
-    HOENN_TO_NATIONAL(GARDEVOIR),
-    HOENN_TO_NATIONAL(GALLADE),
-    HOENN_TO_NATIONAL(SURSKIT),
-    HOENN_TO_NATIONAL(MASQUERAIN),
-    HOENN_TO_NATIONAL(SHROOMISH),
-    HOENN_TO_NATIONAL(BRELOOM),
-    HOENN_TO_NATIONAL(SLAKOTH),
-    HOENN_TO_NATIONAL(VIGOROTH),
-    HOENN_TO_NATIONAL(SLAKING),
-    HOENN_TO_NATIONAL(ABRA),
-    HOENN_TO_NATIONAL(KADABRA),
-    HOENN_TO_NATIONAL(ALAKAZAM),
-    HOENN_TO_NATIONAL(NINCADA),
-    HOENN_TO_NATIONAL(NINJASK),
-    HOENN_TO_NATIONAL(SHEDINJA),
-    HOENN_TO_NATIONAL(WHISMUR),
-    HOENN_TO_NATIONAL(LOUDRED),
-    HOENN_TO_NATIONAL(EXPLOUD),
-    HOENN_TO_NATIONAL(MAKUHITA),
-    HOENN_TO_NATIONAL(HARIYAMA),
-    HOENN_TO_NATIONAL(GOLDEEN),
-    HOENN_TO_NATIONAL(SEAKING),
-    HOENN_TO_NATIONAL(MAGIKARP),
-    HOENN_TO_NATIONAL(GYARADOS),
-    HOENN_TO_NATIONAL(AZURILL),
-    HOENN_TO_NATIONAL(MARILL),
-    HOENN_TO_NATIONAL(AZUMARILL),
-    HOENN_TO_NATIONAL(GEODUDE),
-    HOENN_TO_NATIONAL(GRAVELER),
-    HOENN_TO_NATIONAL(GOLEM),
-    HOENN_TO_NATIONAL(NOSEPASS),
-    HOENN_TO_NATIONAL(PROBOPASS),
-    HOENN_TO_NATIONAL(SKITTY),
-    HOENN_TO_NATIONAL(DELCATTY),
-    HOENN_TO_NATIONAL(ZUBAT),
-    HOENN_TO_NATIONAL(GOLBAT),
-    HOENN_TO_NATIONAL(CROBAT),
-    HOENN_TO_NATIONAL(TENTACOOL),
-    HOENN_TO_NATIONAL(TENTACRUEL),
-    HOENN_TO_NATIONAL(SABLEYE),
-    HOENN_TO_NATIONAL(MAWILE),
-    HOENN_TO_NATIONAL(ARON),
-    HOENN_TO_NATIONAL(LAIRON),
-    HOENN_TO_NATIONAL(AGGRON),
-    HOENN_TO_NATIONAL(MACHOP),
-    HOENN_TO_NATIONAL(MACHOKE),
-    HOENN_TO_NATIONAL(MACHAMP),
-    HOENN_TO_NATIONAL(MEDITITE),
-    HOENN_TO_NATIONAL(MEDICHAM),
-    HOENN_TO_NATIONAL(ELECTRIKE),
-    HOENN_TO_NATIONAL(MANECTRIC),
-    HOENN_TO_NATIONAL(PLUSLE),
-    HOENN_TO_NATIONAL(MINUN),
-    HOENN_TO_NATIONAL(MAGNEMITE),
-    HOENN_TO_NATIONAL(MAGNETON),
-    HOENN_TO_NATIONAL(MAGNEZONE),
-    HOENN_TO_NATIONAL(VOLTORB),
-    HOENN_TO_NATIONAL(ELECTRODE),
-    HOENN_TO_NATIONAL(VOLBEAT),
-    HOENN_TO_NATIONAL(ILLUMISE),
-    HOENN_TO_NATIONAL(ODDISH),
-    HOENN_TO_NATIONAL(GLOOM),
-    HOENN_TO_NATIONAL(VILEPLUME),
-    HOENN_TO_NATIONAL(BELLOSSOM),
-    HOENN_TO_NATIONAL(DODUO),
-    HOENN_TO_NATIONAL(DODRIO),
-    HOENN_TO_NATIONAL(BUDEW),
-    HOENN_TO_NATIONAL(ROSELIA),
-    HOENN_TO_NATIONAL(ROSERADE),
-    HOENN_TO_NATIONAL(GULPIN),
-    HOENN_TO_NATIONAL(SWALOT),
-    HOENN_TO_NATIONAL(CARVANHA),
-    HOENN_TO_NATIONAL(SHARPEDO),
-    HOENN_TO_NATIONAL(WAILMER),
-    HOENN_TO_NATIONAL(WAILORD),
-    HOENN_TO_NATIONAL(NUMEL),
-    HOENN_TO_NATIONAL(CAMERUPT),
-    HOENN_TO_NATIONAL(SLUGMA),
-    HOENN_TO_NATIONAL(MAGCARGO),
-    HOENN_TO_NATIONAL(TORKOAL),
-    HOENN_TO_NATIONAL(GRIMER),
-    HOENN_TO_NATIONAL(MUK),
-    HOENN_TO_NATIONAL(KOFFING),
-    HOENN_TO_NATIONAL(WEEZING),
-    HOENN_TO_NATIONAL(SPOINK),
-    HOENN_TO_NATIONAL(GRUMPIG),
-    HOENN_TO_NATIONAL(SANDSHREW),
-    HOENN_TO_NATIONAL(SANDSLASH),
-    HOENN_TO_NATIONAL(SPINDA),
-    HOENN_TO_NATIONAL(SKARMORY),
-    HOENN_TO_NATIONAL(TRAPINCH),
-    HOENN_TO_NATIONAL(VIBRAVA),
-    HOENN_TO_NATIONAL(FLYGON),
-    HOENN_TO_NATIONAL(CACNEA),
-    HOENN_TO_NATIONAL(CACTURNE),
-    HOENN_TO_NATIONAL(SWABLU),
-    HOENN_TO_NATIONAL(ALTARIA),
-    HOENN_TO_NATIONAL(ZANGOOSE),
-    HOENN_TO_NATIONAL(SEVIPER),
-    HOENN_TO_NATIONAL(LUNATONE),
-    HOENN_TO_NATIONAL(SOLROCK),
-    HOENN_TO_NATIONAL(BARBOACH),
-    HOENN_TO_NATIONAL(WHISCASH),
-    HOENN_TO_NATIONAL(CORPHISH),
-    HOENN_TO_NATIONAL(CRAWDAUNT),
-    HOENN_TO_NATIONAL(BALTOY),
-    HOENN_TO_NATIONAL(CLAYDOL),
-    HOENN_TO_NATIONAL(LILEEP),
-    HOENN_TO_NATIONAL(CRADILY),
-    HOENN_TO_NATIONAL(ANORITH),
-    HOENN_TO_NATIONAL(ARMALDO),
-    HOENN_TO_NATIONAL(IGGLYBUFF),
-    HOENN_TO_NATIONAL(JIGGLYPUFF),
-    HOENN_TO_NATIONAL(WIGGLYTUFF),
-    HOENN_TO_NATIONAL(FEEBAS),
-    HOENN_TO_NATIONAL(MILOTIC),
-    HOENN_TO_NATIONAL(CASTFORM),
-    HOENN_TO_NATIONAL(STARYU),
-    HOENN_TO_NATIONAL(STARMIE),
-    HOENN_TO_NATIONAL(KECLEON),
-    HOENN_TO_NATIONAL(SHUPPET),
-    HOENN_TO_NATIONAL(BANETTE),
-    HOENN_TO_NATIONAL(DUSKULL),
-    HOENN_TO_NATIONAL(DUSCLOPS),
-    HOENN_TO_NATIONAL(DUSKNOIR),
-    HOENN_TO_NATIONAL(TROPIUS),
-    HOENN_TO_NATIONAL(CHINGLING),
-    HOENN_TO_NATIONAL(CHIMECHO),
-    HOENN_TO_NATIONAL(ABSOL),
-    HOENN_TO_NATIONAL(VULPIX),
-    HOENN_TO_NATIONAL(NINETALES),
-    HOENN_TO_NATIONAL(PICHU),
-    HOENN_TO_NATIONAL(PIKACHU),
-    HOENN_TO_NATIONAL(RAICHU),
-    HOENN_TO_NATIONAL(PSYDUCK),
-    HOENN_TO_NATIONAL(GOLDUCK),
-    HOENN_TO_NATIONAL(WYNAUT),
-    HOENN_TO_NATIONAL(WOBBUFFET),
-    HOENN_TO_NATIONAL(NATU),
-    HOENN_TO_NATIONAL(XATU),
-    HOENN_TO_NATIONAL(GIRAFARIG),
-    HOENN_TO_NATIONAL(PHANPY),
-    HOENN_TO_NATIONAL(DONPHAN),
-    HOENN_TO_NATIONAL(PINSIR),
-    HOENN_TO_NATIONAL(HERACROSS),
-    HOENN_TO_NATIONAL(RHYHORN),
-    HOENN_TO_NATIONAL(RHYDON),
-    HOENN_TO_NATIONAL(RHYPERIOR),
-    HOENN_TO_NATIONAL(SNORUNT),
-    HOENN_TO_NATIONAL(GLALIE),
-    HOENN_TO_NATIONAL(FROSLASS),
-    HOENN_TO_NATIONAL(SPHEAL),
-    HOENN_TO_NATIONAL(SEALEO),
-    HOENN_TO_NATIONAL(WALREIN),
-    HOENN_TO_NATIONAL(CLAMPERL),
-    HOENN_TO_NATIONAL(HUNTAIL),
-    HOENN_TO_NATIONAL(GOREBYSS),
-    HOENN_TO_NATIONAL(RELICANTH),
-    HOENN_TO_NATIONAL(CORSOLA),
-    HOENN_TO_NATIONAL(CHINCHOU),
-    HOENN_TO_NATIONAL(LANTURN),
-    HOENN_TO_NATIONAL(LUVDISC),
-    HOENN_TO_NATIONAL(HORSEA),
-    HOENN_TO_NATIONAL(SEADRA),
-    HOENN_TO_NATIONAL(KINGDRA),
-    HOENN_TO_NATIONAL(BAGON),
-    HOENN_TO_NATIONAL(SHELGON),
-    HOENN_TO_NATIONAL(SALAMENCE),
-    HOENN_TO_NATIONAL(BELDUM),
-    HOENN_TO_NATIONAL(METANG),
-    HOENN_TO_NATIONAL(METAGROSS),
-    HOENN_TO_NATIONAL(REGIROCK),
-    HOENN_TO_NATIONAL(REGICE),
-    HOENN_TO_NATIONAL(REGISTEEL),
-    HOENN_TO_NATIONAL(LATIAS),
-    HOENN_TO_NATIONAL(LATIOS),
-    HOENN_TO_NATIONAL(KYOGRE),
-    HOENN_TO_NATIONAL(GROUDON),
-    HOENN_TO_NATIONAL(RAYQUAZA),
-    HOENN_TO_NATIONAL(JIRACHI),
-    HOENN_TO_NATIONAL(DEOXYS),
+#include "data/pokemon/hoenn_to_national_dex.h"
+};
+
+// The reverse lookups are generated from the same lists as the tables above,
+// so every dex conversion is a single index instead of a scan over all species.
+// They are indexed by dex number directly. Forms share their base species'
+// dex number and are left out, so it resolves to the base species as the old scan did.
+#undef SPECIES_TO_HOENN
+#undef SPECIES_TO_NATIONAL
+#undef HOENN_TO_NATIONAL
+#define SPECIES_TO_HOENN(name)      [HOENN_DEX_##name] = SPECIES_##name
+#define SPECIES_TO_NATIONAL(name)   [NATIONAL_DEX_##name] = SPECIES_##name
+#define HOENN_TO_NATIONAL(name)     [NATIONAL_DEX_##name] = HOENN_DEX_##name
+
+static const u16 sHoennPokedexNumToSpecies[HOENN_DEX_COUNT] =
+{
+#include "data/pokemon/species_to_hoenn_dex.h"
+};
+
+static const u16 sNationalPokedexNumToSpecies[NATIONAL_DEX_COUNT + 1] =
+{
+#include "data/pokemon/species_to_national_dex.h"
+};
+
+static const u16 sNationalToHoennOrder[NATIONAL_DEX_COUNT + 1] =
+{
+#include "data/pokemon/hoenn_to_national_dex.h"
 };
 
 const struct SpindaSpot gSpindaSpotGraphics[] =
@@ -1858,6 +190,7 @@ const s8 gNatureStatTable[NUM_NATURES][NUM_NATURE_STATS] =
 #include "data/pokemon/base_stats.h"
 #include "data/pokemon/level_up_learnsets.h"
 #include "data/pokemon/evolution.h"
+#include "data/pokemon/evolution_families.h"
 #include "data/pokemon/level_up_learnset_pointers.h"
 #include "data/pokemon/form_species_tables.h"
 #include "data/pokemon/form_species_table_pointers.h"
@@ -3867,31 +2200,39 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 {                                                               \
     u8 baseStat = gBaseStats[species].base;                     \
     s32 n = (((2 * baseStat + iv + ev / 4) * level) / 100) + 5; \
-    u8 nature = GetMonData(mon, MON_DATA_NATURE);               \
     n = ModifyStatByNature(nature, n, statIndex);               \
     SetMonData(mon, field, &n);                                 \
 }
 
 void CalculateMonStats(struct Pokemon *mon)
 {
+    struct DecodedBoxMon decoded;
     s32 oldMaxHP = GetMonData(mon, MON_DATA_MAX_HP, NULL);
     s32 currentHP = GetMonData(mon, MON_DATA_HP, NULL);
-    s32 hpIV = GetMonData(mon, MON_DATA_HP_IV, NULL);
-    s32 hpEV = GetMonData(mon, MON_DATA_HP_EV, NULL);
-    s32 attackIV = GetMonData(mon, MON_DATA_ATK_IV, NULL);
-    s32 attackEV = GetMonData(mon, MON_DATA_ATK_EV, NULL);
-    s32 defenseIV = GetMonData(mon, MON_DATA_DEF_IV, NULL);
-    s32 defenseEV = GetMonData(mon, MON_DATA_DEF_EV, NULL);
-    s32 speedIV = GetMonData(mon, MON_DATA_SPEED_IV, NULL);
-    s32 speedEV = GetMonData(mon, MON_DATA_SPEED_EV, NULL);
-    s32 spAttackIV = GetMonData(mon, MON_DATA_SPATK_IV, NULL);
-    s32 spAttackEV = GetMonData(mon, MON_DATA_SPATK_EV, NULL);
-    s32 spDefenseIV = GetMonData(mon, MON_DATA_SPDEF_IV, NULL);
-    s32 spDefenseEV = GetMonData(mon, MON_DATA_SPDEF_EV, NULL);
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    s32 level = GetLevelFromMonExp(mon);
+    s32 hpIV, hpEV, attackIV, attackEV, defenseIV, defenseEV, speedIV, speedEV;
+    s32 spAttackIV, spAttackEV, spDefenseIV, spDefenseEV;
+    u16 species;
+    u8 nature;
+    s32 level;
     s32 newMaxHP;
 
+    DecodeBoxMon(&mon->box, &decoded);
+    hpIV = GetDecodedBoxMonData(&decoded, MON_DATA_HP_IV, NULL);
+    hpEV = GetDecodedBoxMonData(&decoded, MON_DATA_HP_EV, NULL);
+    attackIV = GetDecodedBoxMonData(&decoded, MON_DATA_ATK_IV, NULL);
+    attackEV = GetDecodedBoxMonData(&decoded, MON_DATA_ATK_EV, NULL);
+    defenseIV = GetDecodedBoxMonData(&decoded, MON_DATA_DEF_IV, NULL);
+    defenseEV = GetDecodedBoxMonData(&decoded, MON_DATA_DEF_EV, NULL);
+    speedIV = GetDecodedBoxMonData(&decoded, MON_DATA_SPEED_IV, NULL);
+    speedEV = GetDecodedBoxMonData(&decoded, MON_DATA_SPEED_EV, NULL);
+    spAttackIV = GetDecodedBoxMonData(&decoded, MON_DATA_SPATK_IV, NULL);
+    spAttackEV = GetDecodedBoxMonData(&decoded, MON_DATA_SPATK_EV, NULL);
+    spDefenseIV = GetDecodedBoxMonData(&decoded, MON_DATA_SPDEF_IV, NULL);
+    spDefenseEV = GetDecodedBoxMonData(&decoded, MON_DATA_SPDEF_EV, NULL);
+    species = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL);
+    nature = GetDecodedBoxMonData(&decoded, MON_DATA_NATURE, NULL);
+    level = GetLevelFromDecodedBoxMonExp(&decoded);
+
     SetMonData(mon, MON_DATA_LEVEL, &level);
     if (species == SPECIES_SHEDINJA)
     {
@@ -3953,28 +2294,32 @@ void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest)
     CalculateMonStats(dest);
 }
 
-u8 GetLevelFromMonExp(struct Pokemon *mon)
+static u8 GetLevelFromExp(u16 species, u32 exp)
 {
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetMonData(mon, MON_DATA_EXP, NULL);
     s32 level = 1;
-	
+
     while (level <= MAX_LEVEL && gExperienceTables[gBaseStats[species].growthRate][level] <= exp)
-	level++;
+        level++;
 
     return level - 1;
 }
 
+u8 GetLevelFromMonExp(struct Pokemon *mon)
+{
+    return GetLevelFromBoxMonExp(&mon->box);
+}
+
 u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon)
 {
-    u16 species = GetBoxMonData(boxMon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetBoxMonData(boxMon, MON_DATA_EXP, NULL);
-    s32 level = 1;
-	
-    while (level <= MAX_LEVEL && gExperienceTables[gBaseStats[species].growthRate][level] <= exp)
-	level++;
+    struct DecodedBoxMon decoded;
 
-    return level - 1;
+    DecodeBoxMon(boxMon, &decoded);
+    return GetLevelFromDecodedBoxMonExp(&decoded);
+}
+
+u8 GetLevelFromDecodedBoxMonExp(struct DecodedBoxMon *decoded)
+{
+    return GetLevelFromExp(GetDecodedBoxMonData(decoded, MON_DATA_SPECIES, NULL), GetDecodedBoxMonData(decoded, MON_DATA_EXP, NULL));
 }
 
 u16 GiveMoveToMon(struct Pokemon *mon, u16 move)
@@ -4480,32 +2825,10 @@ u32 GetMonData(struct Pokemon *mon, s32 field, u8* data)
     return ret;
 }
 
-u32 GetBoxMonData(struct BoxPokemon *boxMon, s32 field, u8 *data)
+static u32 GetBoxMonDataFromSubstructs(struct BoxPokemon *boxMon, struct PokemonSubstruct0 *substruct0, struct PokemonSubstruct1 *substruct1, struct PokemonSubstruct2 *substruct2, struct PokemonSubstruct3 *substruct3, s32 field, u8 *data)
 {
     s32 i;
     u32 retVal = 0;
-    struct PokemonSubstruct0 *substruct0 = NULL;
-    struct PokemonSubstruct1 *substruct1 = NULL;
-    struct PokemonSubstruct2 *substruct2 = NULL;
-    struct PokemonSubstruct3 *substruct3 = NULL;
-
-    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
-    {
-        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
-        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
-        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
-        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
-
-        DecryptBoxMon(boxMon);
-
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
-        {
-            boxMon->isBadEgg = 1;
-            boxMon->isEgg = 1;
-            substruct3->isEgg = 1;
-        }
-    }
 
     switch (field)
     {
@@ -4793,6 +3116,37 @@ u32 GetBoxMonData(struct BoxPokemon *boxMon, s32 field, u8 *data)
         break;
     }
 
+    return retVal;
+}
+
+u32 GetBoxMonData(struct BoxPokemon *boxMon, s32 field, u8 *data)
+{
+    u32 retVal;
+    struct PokemonSubstruct0 *substruct0 = NULL;
+    struct PokemonSubstruct1 *substruct1 = NULL;
+    struct PokemonSubstruct2 *substruct2 = NULL;
+    struct PokemonSubstruct3 *substruct3 = NULL;
+
+    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+    {
+        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
+        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
+        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
+        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
+
+        DecryptBoxMon(boxMon);
+
+        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
+        {
+            boxMon->isBadEgg = 1;
+            boxMon->isEgg = 1;
+            substruct3->isEgg = 1;
+        }
+    }
+
+    retVal = GetBoxMonDataFromSubstructs(boxMon, substruct0, substruct1, substruct2, substruct3, field, data);
+
     if (field > MON_DATA_ENCRYPT_SEPARATOR)
         EncryptBoxMon(boxMon);
 
@@ -4847,34 +3201,8 @@ void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg)
     }
 }
 
-void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
+static void SetBoxMonDataInSubstructs(struct BoxPokemon *boxMon, struct PokemonSubstruct0 *substruct0, struct PokemonSubstruct1 *substruct1, struct PokemonSubstruct2 *substruct2, struct PokemonSubstruct3 *substruct3, s32 field, const u8 *data)
 {
-    const u8 *data = dataArg;
-
-    struct PokemonSubstruct0 *substruct0 = NULL;
-    struct PokemonSubstruct1 *substruct1 = NULL;
-    struct PokemonSubstruct2 *substruct2 = NULL;
-    struct PokemonSubstruct3 *substruct3 = NULL;
-
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
-    {
-        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
-        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
-        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
-        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
-
-        DecryptBoxMon(boxMon);
-
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
-        {
-            boxMon->isBadEgg = 1;
-            boxMon->isEgg = 1;
-            substruct3->isEgg = 1;
-            EncryptBoxMon(boxMon);
-            return;
-        }
-    }
-
     switch (field)
     {
     case MON_DATA_PERSONALITY:
@@ -5146,6 +3474,35 @@ void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
     default:
         break;
     }
+}
+
+void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
+{
+    struct PokemonSubstruct0 *substruct0 = NULL;
+    struct PokemonSubstruct1 *substruct1 = NULL;
+    struct PokemonSubstruct2 *substruct2 = NULL;
+    struct PokemonSubstruct3 *substruct3 = NULL;
+
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+    {
+        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
+        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
+        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
+        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
+
+        DecryptBoxMon(boxMon);
+
+        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
+        {
+            boxMon->isBadEgg = 1;
+            boxMon->isEgg = 1;
+            substruct3->isEgg = 1;
+            EncryptBoxMon(boxMon);
+            return;
+        }
+    }
+
+    SetBoxMonDataInSubstructs(boxMon, substruct0, substruct1, substruct2, substruct3, field, dataArg);
 
     if (field > MON_DATA_ENCRYPT_SEPARATOR)
     {
@@ -5154,6 +3511,99 @@ void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
     }
 }
 
+static void EncodeSubstruct(struct BoxPokemon *boxMon, const union PokemonSubstruct *src, u8 substructType)
+{
+    u32 i;
+    u32 key = boxMon->personality ^ boxMon->otId;
+    const u32 *from = (const u32 *)src;
+    u32 *to = (u32 *)GetSubstruct(boxMon, boxMon->personality, substructType);
+
+    for (i = 0; i < sizeof(union PokemonSubstruct) / 4; i++)
+        to[i] = from[i] ^ key;
+}
+
+static u16 CalculateDecodedBoxMonChecksum(const struct DecodedBoxMon *decoded)
+{
+    u16 checksum = 0;
+    s32 i, j;
+
+    for (i = 0; i < 4; i++)
+    {
+        for (j = 0; j < 6; j++)
+            checksum += decoded->substructs[i].raw[j];
+    }
+
+    return checksum;
+}
+
+void DecodeBoxMon(struct BoxPokemon *boxMon, struct DecodedBoxMon *decoded)
+{
+    u32 i, j;
+    u32 key = boxMon->personality ^ boxMon->otId;
+
+    decoded->boxMon = boxMon;
+    decoded->modified = FALSE;
+    for (i = 0; i < 4; i++)
+    {
+        const u32 *from = (const u32 *)GetSubstruct(boxMon, boxMon->personality, i);
+        u32 *to = (u32 *)&decoded->substructs[i];
+
+        for (j = 0; j < sizeof(union PokemonSubstruct) / 4; j++)
+            to[j] = from[j] ^ key;
+    }
+
+    decoded->isValid = (CalculateDecodedBoxMonChecksum(decoded) == boxMon->checksum);
+    if (!decoded->isValid)
+    {
+        // Same as GetBoxMonData: flag the mon as a Bad Egg without fixing the checksum.
+        boxMon->isBadEgg = 1;
+        boxMon->isEgg = 1;
+        decoded->substructs[3].type3.isEgg = 1;
+        EncodeSubstruct(boxMon, &decoded->substructs[3], 3);
+    }
+}
+
+u32 GetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, u8 *data)
+{
+    return GetBoxMonDataFromSubstructs(decoded->boxMon,
+                                       &decoded->substructs[0].type0,
+                                       &decoded->substructs[1].type1,
+                                       &decoded->substructs[2].type2,
+                                       &decoded->substructs[3].type3,
+                                       field, data);
+}
+
+void SetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, const void *dataArg)
+{
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+    {
+        // Like SetBoxMonData, encrypted fields of a Bad Egg are left alone.
+        if (!decoded->isValid)
+            return;
+        decoded->modified = TRUE;
+    }
+
+    SetBoxMonDataInSubstructs(decoded->boxMon,
+                              &decoded->substructs[0].type0,
+                              &decoded->substructs[1].type1,
+                              &decoded->substructs[2].type2,
+                              &decoded->substructs[3].type3,
+                              field, dataArg);
+}
+
+void CommitDecodedBoxMon(struct DecodedBoxMon *decoded)
+{
+    u32 i;
+
+    if (!decoded->modified)
+        return;
+
+    decoded->boxMon->checksum = CalculateDecodedBoxMonChecksum(decoded);
+    for (i = 0; i < 4; i++)
+        EncodeSubstruct(decoded->boxMon, &decoded->substructs[i], i);
+    decoded->modified = FALSE;
+}
+
 void CopyMon(void *dest, void *src, size_t size)
 {
     memcpy(dest, src, size);
@@ -5219,11 +3669,10 @@ u8 SendMonToPC(struct Pokemon* mon)
     {
         for (boxPos = 0; boxPos < IN_BOX_COUNT; boxPos++)
         {
-            struct BoxPokemon* checkingMon = GetBoxedMonPtr(boxNo, boxPos);
-            if (GetBoxMonData(checkingMon, MON_DATA_SPECIES, NULL) == SPECIES_NONE)
+            if (GetBoxMonDataAt(boxNo, boxPos, MON_DATA_SPECIES) == SPECIES_NONE)
             {
                 MonRestorePP(mon);
-                CopyMon(checkingMon, &mon->box, sizeof(mon->box));
+                CopyMon(GetBoxedMonPtr(boxNo, boxPos), &mon->box, sizeof(mon->box));
                 gSpecialVar_MonBoxId = boxNo;
                 gSpecialVar_MonBoxPos = boxPos;
                 if (GetPCBoxToSendMon() != boxNo)
@@ -5516,24 +3965,26 @@ void PokemonToBattleMon(struct Pokemon *src, struct BattlePokemon *dst)
 {
     s32 i;
     u8 nickname[POKEMON_NAME_LENGTH * 2];
+    struct DecodedBoxMon decoded;
 
+    DecodeBoxMon(&src->box, &decoded);
     for (i = 0; i < MAX_MON_MOVES; i++)
     {
-        dst->moves[i] = GetMonData(src, MON_DATA_MOVE1 + i, NULL);
-        dst->pp[i] = GetMonData(src, MON_DATA_PP1 + i, NULL);
-    }
-
-    dst->species = GetMonData(src, MON_DATA_SPECIES, NULL);
-    dst->item = GetMonData(src, MON_DATA_HELD_ITEM, NULL);
-    dst->ppBonuses = GetMonData(src, MON_DATA_PP_BONUSES, NULL);
-    dst->friendship = GetMonData(src, MON_DATA_FRIENDSHIP, NULL);
-    dst->experience = GetMonData(src, MON_DATA_EXP, NULL);
-    dst->hpIV = GetMonData(src, MON_DATA_HP_IV, NULL);
-    dst->attackIV = GetMonData(src, MON_DATA_ATK_IV, NULL);
-    dst->defenseIV = GetMonData(src, MON_DATA_DEF_IV, NULL);
-    dst->speedIV = GetMonData(src, MON_DATA_SPEED_IV, NULL);
-    dst->spAttackIV = GetMonData(src, MON_DATA_SPATK_IV, NULL);
-    dst->spDefenseIV = GetMonData(src, MON_DATA_SPDEF_IV, NULL);
+        dst->moves[i] = GetDecodedBoxMonData(&decoded, MON_DATA_MOVE1 + i, NULL);
+        dst->pp[i] = GetDecodedBoxMonData(&decoded, MON_DATA_PP1 + i, NULL);
+    }
+
+    dst->species = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL);
+    dst->item = GetDecodedBoxMonData(&decoded, MON_DATA_HELD_ITEM, NULL);
+    dst->ppBonuses = GetDecodedBoxMonData(&decoded, MON_DATA_PP_BONUSES, NULL);
+    dst->friendship = GetDecodedBoxMonData(&decoded, MON_DATA_FRIENDSHIP, NULL);
+    dst->experience = GetDecodedBoxMonData(&decoded, MON_DATA_EXP, NULL);
+    dst->hpIV = GetDecodedBoxMonData(&decoded, MON_DATA_HP_IV, NULL);
+    dst->attackIV = GetDecodedBoxMonData(&decoded, MON_DATA_ATK_IV, NULL);
+    dst->defenseIV = GetDecodedBoxMonData(&decoded, MON_DATA_DEF_IV, NULL);
+    dst->speedIV = GetDecodedBoxMonData(&decoded, MON_DATA_SPEED_IV, NULL);
+    dst->spAttackIV = GetDecodedBoxMonData(&decoded, MON_DATA_SPATK_IV, NULL);
+    dst->spDefenseIV = GetDecodedBoxMonData(&decoded, MON_DATA_SPDEF_IV, NULL);
     dst->personality = GetMonData(src, MON_DATA_PERSONALITY, NULL);
     dst->status1 = GetMonData(src, MON_DATA_STATUS, NULL);
     dst->level = GetMonData(src, MON_DATA_LEVEL, NULL);
@@ -5544,13 +3995,13 @@ void PokemonToBattleMon(struct Pokemon *src, struct BattlePokemon *dst)
     dst->speed = GetMonData(src, MON_DATA_SPEED, NULL);
     dst->spAttack = GetMonData(src, MON_DATA_SPATK, NULL);
     dst->spDefense = GetMonData(src, MON_DATA_SPDEF, NULL);
-    dst->abilityNum = GetMonData(src, MON_DATA_ABILITY_NUM, NULL);
+    dst->abilityNum = GetDecodedBoxMonData(&decoded, MON_DATA_ABILITY_NUM, NULL);
     dst->otId = GetMonData(src, MON_DATA_OT_ID, NULL);
     dst->type1 = gBaseStats[dst->species].type1;
     dst->type2 = gBaseStats[dst->species].type2;
     dst->type3 = TYPE_MYSTERY;
     dst->ability = GetAbilityBySpecies(dst->species, dst->abilityNum);
-    dst->nature = GetMonData(src, MON_DATA_NATURE, NULL);
+    dst->nature = GetDecodedBoxMonData(&decoded, MON_DATA_NATURE, NULL);
     GetMonData(src, MON_DATA_NICKNAME, nickname);
     StringCopy10(dst->nickname, nickname);
     GetMonData(src, MON_DATA_OT_NAME, dst->otName);
@@ -6740,58 +5191,63 @@ u16 GetEvolutionTargetSpecies(struct Pokemon *mon, u8 mode, u16 evolutionItem, u
     return targetSpecies;
 }
 
-u16 HoennPokedexNumToSpecies(u16 hoennNum)
+u16 GetPreEvolution(u16 species)
 {
-    u16 species;
+    if (species >= NUM_SPECIES)
+        return SPECIES_NONE;
 
-    if (!hoennNum)
-        return 0;
+    return gPreEvolutionTable[species];
+}
 
-    species = 0;
+// The first stage of species' family, the species its eggs hatch into.
+u16 GetEvolutionFamilyRoot(u16 species)
+{
+    if (species >= NUM_SPECIES)
+        return species;
 
-    while (species < (NUM_SPECIES - 1) && gSpeciesToHoennPokedexNum[species] != hoennNum)
-        species++;
+    return gEvolutionFamily[species].root;
+}
 
-    if (species == NUM_SPECIES - 1)
+// 0 for the first stage of a family, 1 for its evolutions, and so on.
+u8 GetEvolutionStage(u16 species)
+{
+    if (species >= NUM_SPECIES)
         return 0;
 
-    return species + 1;
+    return gEvolutionFamily[species].stage;
 }
 
-u16 NationalPokedexNumToSpecies(u16 nationalNum)
+// Follows the first evolution of species, ignoring Mega Evolution, until it doesn't evolve anymore.
+u16 GetFinalEvolution(u16 species)
 {
-    u16 species;
-
-    if (!nationalNum)
-        return 0;
-
-    species = 0;
+    if (species >= NUM_SPECIES)
+        return species;
 
-    while (species < (NUM_SPECIES - 1) && gSpeciesToNationalPokedexNum[species] != nationalNum)
-        species++;
+    return gEvolutionFamily[species].final;
+}
 
-    if (species == NUM_SPECIES - 1)
+u16 HoennPokedexNumToSpecies(u16 hoennNum)
+{
+    if (!hoennNum || hoennNum >= HOENN_DEX_COUNT)
         return 0;
 
-    return species + 1;
+    return sHoennPokedexNumToSpecies[hoennNum];
 }
 
-u16 NationalToHoennOrder(u16 nationalNum)
+u16 NationalPokedexNumToSpecies(u16 nationalNum)
 {
-    u16 hoennNum;
-
-    if (!nationalNum)
+    if (!nationalNum || nationalNum > NATIONAL_DEX_COUNT)
         return 0;
 
-    hoennNum = 0;
-
-    while (hoennNum < (HOENN_DEX_COUNT - 1) && gHoennToNationalOrder[hoennNum] != nationalNum)
-        hoennNum++;
+    return sNationalPokedexNumToSpecies[nationalNum];
+}
 
-    if (hoennNum >= HOENN_DEX_COUNT - 1)
+u16 NationalToHoennOrder(u16 nationalNum)
+{
+    if (!nationalNum || nationalNum > NATIONAL_DEX_COUNT)
         return 0;
 
-    return hoennNum + 1;
+    return sNationalToHoennOrder[nationalNum];
 }
 
 u16 SpeciesToNationalPokedexNum(u16 species)
@@ -455,6 +455,8 @@ struct PokemonStorageSystemData
     struct Sprite **releaseMonSpritePtr;
     u16 numIconsPerSpecies[MAX_MON_ICONS];
     u16 iconSpeciesList[MAX_MON_ICONS];
+    u32 iconLastUsed[MAX_MON_ICONS];
+    u32 iconUseClock;
     u16 boxSpecies[IN_BOX_COUNT];
     u32 boxPersonalities[IN_BOX_COUNT];
     u8 incomingBoxId;
@@ -552,6 +554,26 @@ struct PokemonStorageSystemData
     u8 displayMenuTilemapBuffer[0x800];
 };
 
+// Decrypted copy of the fields the storage system reads most often from a box
+// slot. Each entry is keyed on the slot's unencrypted header and checksum,
+// which change whenever anything in the slot is written, so it is refreshed
+// the first time it is read after a write without any explicit invalidation.
+struct BoxMonSummary
+{
+    u32 personality;
+    u32 otId;
+    u16 checksum;
+    u16 species;
+    u16 species2;
+    u16 heldItem;
+    u8 isBadEgg:1;
+    u8 hasSpecies:1;
+    u8 isEggFlag:1;
+    u8 isEgg:1;
+    u8 unused:4;
+    u8 level;
+};
+
 static u32 sItemIconGfxBuffer[98];
 
 EWRAM_DATA static u8 sPreviousBoxOption = 0;
@@ -570,6 +592,7 @@ EWRAM_DATA static bool8 sIsMonBeingMoved = 0;
 EWRAM_DATA static u8 sMovingMonOrigBoxId = 0;
 EWRAM_DATA static u8 sMovingMonOrigBoxPos = 0;
 EWRAM_DATA static bool8 sAutoActionOn = 0;
+EWRAM_DATA static struct BoxMonSummary sBoxMonSummaries[TOTAL_BOXES_COUNT][IN_BOX_COUNT] = {0};
 
 // Main tasks
 static void EnterPokeStorage(u8);
@@ -636,6 +659,7 @@ static void RemoveMenu(void);
 static void InitMonIconFields(void);
 static void SpriteCB_BoxMonIconScrollOut(struct Sprite *);
 static void GetIncomingBoxMonData(u8);
+static void PrefetchBoxMonIconTiles(u8);
 static void CreatePartyMonsSprites(bool8);
 static void CompactPartySprites(void);
 static u8 GetNumPartySpritesCompacting(void);
@@ -4434,6 +4458,9 @@ static void InitMonIconFields(void)
         sStorage->numIconsPerSpecies[i] = 0;
     for (i = 0; i < MAX_MON_ICONS; i++)
         sStorage->iconSpeciesList[i] = SPECIES_NONE;
+    for (i = 0; i < MAX_MON_ICONS; i++)
+        sStorage->iconLastUsed[i] = 0;
+    sStorage->iconUseClock = 0;
     for (i = 0; i < PARTY_SIZE; i++)
         sStorage->partySprites[i] = NULL;
     for (i = 0; i < IN_BOX_COUNT; i++)
@@ -4464,6 +4491,7 @@ static void InitBoxMonSprites(u8 boxId)
     u16 i, j, count;
     u16 species;
     u32 personality;
+    struct DecodedBoxMon decoded;
 
     count = 0;
     boxPosition = 0;
@@ -4473,11 +4501,16 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            species = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES2);
+            DecodeBoxMon(GetBoxedMonPtr(boxId, boxPosition), &decoded);
+            species = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES2, NULL);
             if (species != SPECIES_NONE)
             {
-                personality = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
+                personality = GetDecodedBoxMonData(&decoded, MON_DATA_PERSONALITY, NULL);
                 sStorage->boxMonsSprites[count] = CreateMonIconSprite(species, personality, 8 * (3 * j) + 100, 8 * (3 * i) + 44, 2, 19 - j);
+
+                // If in item mode, set all Pokémon icons with no item to be transparent
+                if (sStorage->boxOption == OPTION_MOVE_ITEMS && GetDecodedBoxMonData(&decoded, MON_DATA_HELD_ITEM, NULL) == ITEM_NONE)
+                    sStorage->boxMonsSprites[count]->oam.objMode = ST_OAM_OBJ_BLEND;
             }
             else
             {
@@ -4487,16 +4520,6 @@ static void InitBoxMonSprites(u8 boxId)
             count++;
         }
     }
-
-    // If in item mode, set all Pokémon icons with no item to be transparent
-    if (sStorage->boxOption == OPTION_MOVE_ITEMS)
-    {
-        for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
-        {
-            if (GetBoxMonDataAt(boxId, boxPosition, MON_DATA_HELD_ITEM) == ITEM_NONE)
-                sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
-        }
-    }
 }
 
 static void CreateBoxMonIconAtPos(u8 boxPosition)
@@ -4716,6 +4739,9 @@ static bool8 UpdateBoxMonIconScroll(void)
         if (sStorage->iconScrollNumIncoming == 0)
         {
             sStorage->iconScrollDistance++;
+            // Warm up the next box in the same direction for a continued scroll
+            PrefetchBoxMonIconTiles((sStorage->iconScrollToBoxId + TOTAL_BOXES_COUNT + sStorage->iconScrollDirection) % TOTAL_BOXES_COUNT);
+            sStorage->iconScrollState++;
             return FALSE;
         }
         break;
@@ -5111,9 +5137,30 @@ static void SpriteCB_HeldMon(struct Sprite *sprite)
     sprite->y = sStorage->cursorSprite->y + sStorage->cursorSprite->y2 + 4;
 }
 
-static u16 TryLoadMonIconTiles(u16 species, u32 personality)
+// Icon tiles stay in VRAM after the last sprite using them is destroyed, so
+// scrolling back to a box doesn't upload them again. Such idle slots are
+// handed out again least recently used first, once no empty slot is left.
+static u16 FindFreeMonIconSlot(void)
+{
+    u16 i, oldest = MAX_MON_ICONS;
+
+    for (i = 0; i < MAX_MON_ICONS; i++)
+    {
+        if (sStorage->iconSpeciesList[i] == SPECIES_NONE)
+            return i;
+        if (sStorage->numIconsPerSpecies[i] == 0
+         && (oldest == MAX_MON_ICONS || sStorage->iconLastUsed[i] < sStorage->iconLastUsed[oldest]))
+            oldest = i;
+    }
+
+    return oldest;
+}
+
+// Returns the icon list slot holding this species' tiles, loading them if
+// they aren't resident, or MAX_MON_ICONS if every slot is in use.
+static u16 GetMonIconSlot(u16 species, u32 personality)
 {
-    u16 i, offset;
+    u16 i;
 
     // Treat female mons as a seperate species as they may have a different icon than males
     if (SpeciesHasGenderDifference[species] && GetGenderFromSpeciesAndPersonality(species, personality) == MON_FEMALE)
@@ -5129,26 +5176,49 @@ static u16 TryLoadMonIconTiles(u16 species, u32 personality)
     if (i == MAX_MON_ICONS)
     {
         // Species not present in the list
-        // Find first empty spot in the list to put it
-        for (i = 0; i < MAX_MON_ICONS; i++)
-        {
-            if (sStorage->iconSpeciesList[i] == 0)
-                break;
-        }
+        i = FindFreeMonIconSlot();
 
         // Failed to find an empty spot
         if (i == MAX_MON_ICONS)
-            return 0xFFFF;
+            return MAX_MON_ICONS;
+
+        sStorage->iconSpeciesList[i] = species;
+        species &= GENDER_MASK;
+        CpuCopy32(GetMonIconTiles(species, personality), (void*)(OBJ_VRAM0) + i * 16 * 32, 0x200);
     }
 
-    // Add species to icon list and load tiles
-    sStorage->iconSpeciesList[i] = species;
+    sStorage->iconLastUsed[i] = ++sStorage->iconUseClock;
+    return i;
+}
+
+static u16 TryLoadMonIconTiles(u16 species, u32 personality)
+{
+    u16 i = GetMonIconSlot(species, personality);
+
+    if (i == MAX_MON_ICONS)
+        return 0xFFFF;
+
     sStorage->numIconsPerSpecies[i]++;
-    offset = 16 * i;
-    species &= GENDER_MASK;
-    CpuCopy32(GetMonIconTiles(species, personality), (void*)(OBJ_VRAM0) + offset * 32, 0x200);
+    return 16 * i;
+}
 
-    return offset;
+// Loads the icons of a box that is likely to be scrolled to next into empty
+// or idle slots, without taking a reference on them.
+static void PrefetchBoxMonIconTiles(u8 boxId)
+{
+    u16 i, species;
+    u32 personality;
+
+    for (i = 0; i < IN_BOX_COUNT; i++)
+    {
+        species = GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES2);
+        if (species != SPECIES_NONE)
+        {
+            personality = GetBoxMonDataAt(boxId, i, MON_DATA_PERSONALITY);
+            if (GetMonIconSlot(GetIconSpecies(species, personality), personality) == MAX_MON_ICONS)
+                break;
+        }
+    }
 }
 
 static void RemoveSpeciesFromIconList(u16 species)
@@ -5169,8 +5239,9 @@ static void RemoveSpeciesFromIconList(u16 species)
     {
         if (sStorage->iconSpeciesList[i] == species && !hasFemale)
         {
-            if (--sStorage->numIconsPerSpecies[i] == 0)
-                sStorage->iconSpeciesList[i] = SPECIES_NONE;
+            // Keep the tiles resident, the slot is reused once it's the oldest idle one
+            if (sStorage->numIconsPerSpecies[i] != 0)
+                sStorage->numIconsPerSpecies[i]--;
             break;
         }
     }
@@ -6932,27 +7003,28 @@ static void SetDisplayMonData(void *pokemon, u8 mode)
     }
     else if (mode == MODE_BOX)
     {
-        struct BoxPokemon *boxMon = (struct BoxPokemon *)pokemon;
+        struct DecodedBoxMon decoded;
 
-        sStorage->displayMonSpecies = GetBoxMonData(pokemon, MON_DATA_SPECIES2);
+        DecodeBoxMon((struct BoxPokemon *)pokemon, &decoded);
+        sStorage->displayMonSpecies = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES2, NULL);
         if (sStorage->displayMonSpecies != SPECIES_NONE)
         {
-            u32 otId = GetBoxMonData(boxMon, MON_DATA_OT_ID);
-            sanityIsBadEgg = GetBoxMonData(boxMon, MON_DATA_SANITY_IS_BAD_EGG);
+            u32 otId = GetDecodedBoxMonData(&decoded, MON_DATA_OT_ID, NULL);
+            sanityIsBadEgg = GetDecodedBoxMonData(&decoded, MON_DATA_SANITY_IS_BAD_EGG, NULL);
             if (sanityIsBadEgg)
                 sStorage->displayMonIsEgg = TRUE;
             else
-                sStorage->displayMonIsEgg = GetBoxMonData(boxMon, MON_DATA_IS_EGG);
+                sStorage->displayMonIsEgg = GetDecodedBoxMonData(&decoded, MON_DATA_IS_EGG, NULL);
 
 
-            GetBoxMonData(boxMon, MON_DATA_NICKNAME, sStorage->displayMonName);
+            GetDecodedBoxMonData(&decoded, MON_DATA_NICKNAME, sStorage->displayMonName);
             StringGetEnd10(sStorage->displayMonName);
-            sStorage->displayMonLevel = GetLevelFromBoxMonExp(boxMon);
-            sStorage->displayMonMarkings = GetBoxMonData(boxMon, MON_DATA_MARKINGS);
-            sStorage->displayMonPersonality = GetBoxMonData(boxMon, MON_DATA_PERSONALITY);
+            sStorage->displayMonLevel = GetLevelFromDecodedBoxMonExp(&decoded);
+            sStorage->displayMonMarkings = GetDecodedBoxMonData(&decoded, MON_DATA_MARKINGS, NULL);
+            sStorage->displayMonPersonality = GetDecodedBoxMonData(&decoded, MON_DATA_PERSONALITY, NULL);
             sStorage->displayMonPalette = GetMonSpritePalFromSpeciesAndPersonality(sStorage->displayMonSpecies, otId, sStorage->displayMonPersonality);
             gender = GetGenderFromSpeciesAndPersonality(sStorage->displayMonSpecies, sStorage->displayMonPersonality);
-            sStorage->displayMonItemId = GetBoxMonData(boxMon, MON_DATA_HELD_ITEM);
+            sStorage->displayMonItemId = GetDecodedBoxMonData(&decoded, MON_DATA_HELD_ITEM, NULL);
         }
     }
     else
@@ -9461,12 +9533,74 @@ static void SetCurrentBox(u8 boxId)
         gPokemonStoragePtr->currentBox = boxId;
 }
 
+static void RefreshBoxMonSummary(struct BoxPokemon *boxMon, struct BoxMonSummary *summary)
+{
+    struct DecodedBoxMon decoded;
+
+    // Decode before reading the unencrypted header, a failed checksum marks the mon as a bad egg.
+    DecodeBoxMon(boxMon, &decoded);
+    summary->species = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL);
+    if (summary->species != SPECIES_NONE)
+    {
+        summary->species2 = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES2, NULL);
+        summary->heldItem = GetDecodedBoxMonData(&decoded, MON_DATA_HELD_ITEM, NULL);
+        summary->isEgg = GetDecodedBoxMonData(&decoded, MON_DATA_IS_EGG, NULL);
+        summary->level = GetLevelFromDecodedBoxMonExp(&decoded);
+    }
+    else
+    {
+        summary->species2 = SPECIES_NONE;
+        summary->heldItem = ITEM_NONE;
+        summary->isEgg = FALSE;
+        summary->level = 0;
+    }
+
+    summary->personality = boxMon->personality;
+    summary->otId = boxMon->otId;
+    summary->checksum = boxMon->checksum;
+    summary->isBadEgg = boxMon->isBadEgg;
+    summary->hasSpecies = boxMon->hasSpecies;
+    summary->isEggFlag = boxMon->isEgg;
+}
+
+static const struct BoxMonSummary *GetBoxMonSummary(u8 boxId, u8 boxPosition)
+{
+    struct BoxPokemon *boxMon = &gPokemonStoragePtr->boxes[boxId][boxPosition];
+    struct BoxMonSummary *summary = &sBoxMonSummaries[boxId][boxPosition];
+
+    if (summary->personality != boxMon->personality
+     || summary->otId != boxMon->otId
+     || summary->checksum != boxMon->checksum
+     || summary->isBadEgg != boxMon->isBadEgg
+     || summary->hasSpecies != boxMon->hasSpecies
+     || summary->isEggFlag != boxMon->isEgg)
+        RefreshBoxMonSummary(boxMon, summary);
+
+    return summary;
+}
+
 u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
-        return GetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], request);
+    {
+        switch (request)
+        {
+        case MON_DATA_SPECIES:
+            return GetBoxMonSummary(boxId, boxPosition)->species;
+        case MON_DATA_SPECIES2:
+            return GetBoxMonSummary(boxId, boxPosition)->species2;
+        case MON_DATA_HELD_ITEM:
+            return GetBoxMonSummary(boxId, boxPosition)->heldItem;
+        case MON_DATA_IS_EGG:
+            return GetBoxMonSummary(boxId, boxPosition)->isEgg;
+        default:
+            return GetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], request);
+        }
+    }
     else
+    {
         return 0;
+    }
 }
 
 void SetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, const void *value)
@@ -9498,7 +9632,7 @@ u32 GetBoxMonLevelAt(u8 boxId, u8 boxPosition)
     u32 lvl;
 
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT && GetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], MON_DATA_SANITY_HAS_SPECIES))
-        lvl = GetLevelFromBoxMonExp(&gPokemonStoragePtr->boxes[boxId][boxPosition]);
+        lvl = GetBoxMonSummary(boxId, boxPosition)->level;
 #ifdef BUGFIX
     else
 #endif
@@ -1469,32 +1469,35 @@ static bool8 ExtractMonDataToSummaryStruct(struct Pokemon *mon)
 {
     u32 i;
     struct PokeSummary *sum = &sMonSummaryScreen->summary;
+    struct DecodedBoxMon decoded;
     // Spread the data extraction over multiple frames.
     switch (sMonSummaryScreen->switchCounter)
     {
     case 0:
-        sum->species = GetMonData(mon, MON_DATA_SPECIES);
-        sum->species2 = GetMonData(mon, MON_DATA_SPECIES2);
-        sum->exp = GetMonData(mon, MON_DATA_EXP);
+        DecodeBoxMon(&mon->box, &decoded);
+        sum->species = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL);
+        sum->species2 = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES2, NULL);
+        sum->exp = GetDecodedBoxMonData(&decoded, MON_DATA_EXP, NULL);
         sum->level = GetMonData(mon, MON_DATA_LEVEL);
-        sum->abilityNum = GetMonData(mon, MON_DATA_ABILITY_NUM);
-        sum->item = GetMonData(mon, MON_DATA_HELD_ITEM);
-        sum->pid = GetMonData(mon, MON_DATA_PERSONALITY);
-        sum->sanity = GetMonData(mon, MON_DATA_SANITY_IS_BAD_EGG);
+        sum->abilityNum = GetDecodedBoxMonData(&decoded, MON_DATA_ABILITY_NUM, NULL);
+        sum->item = GetDecodedBoxMonData(&decoded, MON_DATA_HELD_ITEM, NULL);
+        sum->pid = GetDecodedBoxMonData(&decoded, MON_DATA_PERSONALITY, NULL);
+        sum->sanity = GetDecodedBoxMonData(&decoded, MON_DATA_SANITY_IS_BAD_EGG, NULL);
 
         if (sum->sanity)
             sum->isEgg = TRUE;
         else
-            sum->isEgg = GetMonData(mon, MON_DATA_IS_EGG);
+            sum->isEgg = GetDecodedBoxMonData(&decoded, MON_DATA_IS_EGG, NULL);
 
         break;
     case 1:
+        DecodeBoxMon(&mon->box, &decoded);
         for (i = 0; i < MAX_MON_MOVES; i++)
         {
-            sum->moves[i] = GetMonData(mon, MON_DATA_MOVE1+i);
-            sum->pp[i] = GetMonData(mon, MON_DATA_PP1+i);
+            sum->moves[i] = GetDecodedBoxMonData(&decoded, MON_DATA_MOVE1+i, NULL);
+            sum->pp[i] = GetDecodedBoxMonData(&decoded, MON_DATA_PP1+i, NULL);
         }
-        sum->ppBonuses = GetMonData(mon, MON_DATA_PP_BONUSES);
+        sum->ppBonuses = GetDecodedBoxMonData(&decoded, MON_DATA_PP_BONUSES, NULL);
         break;
     case 2:
         if (sMonSummaryScreen->monList.mons == gPlayerParty || sMonSummaryScreen->mode == SUMMARY_MODE_BOX || sMonSummaryScreen->unk40EF == TRUE)
@@ -1524,12 +1527,13 @@ static bool8 ExtractMonDataToSummaryStruct(struct Pokemon *mon)
         GetMonData(mon, MON_DATA_OT_NAME, sum->OTName);
         ConvertInternationalString(sum->OTName, GetMonData(mon, MON_DATA_LANGUAGE));
         sum->ailment = GetMonAilment(mon);
-        sum->OTGender = GetMonData(mon, MON_DATA_OT_GENDER);
-        sum->OTID = GetMonData(mon, MON_DATA_OT_ID);
-        sum->metLocation = GetMonData(mon, MON_DATA_MET_LOCATION);
-        sum->metLevel = GetMonData(mon, MON_DATA_MET_LEVEL);
-        sum->metGame = GetMonData(mon, MON_DATA_MET_GAME);
-        sum->friendship = GetMonData(mon, MON_DATA_FRIENDSHIP);
+        DecodeBoxMon(&mon->box, &decoded);
+        sum->OTGender = GetDecodedBoxMonData(&decoded, MON_DATA_OT_GENDER, NULL);
+        sum->OTID = GetDecodedBoxMonData(&decoded, MON_DATA_OT_ID, NULL);
+        sum->metLocation = GetDecodedBoxMonData(&decoded, MON_DATA_MET_LOCATION, NULL);
+        sum->metLevel = GetDecodedBoxMonData(&decoded, MON_DATA_MET_LEVEL, NULL);
+        sum->metGame = GetDecodedBoxMonData(&decoded, MON_DATA_MET_GAME, NULL);
+        sum->friendship = GetDecodedBoxMonData(&decoded, MON_DATA_FRIENDSHIP, NULL);
         break;
     default:
         sum->ribbonCount = GetMonData(mon, MON_DATA_RIBBON_COUNT);
@@ -9,6 +9,7 @@
 #include "overworld.h"
 #include "pokemon_storage_system.h"
 #include "main.h"
+#include "item.h"
 #include "trainer_hill.h"
 #include "link.h"
 #include "constants/game_stat.h"
@@ -20,6 +21,7 @@ static u8 sub_8152E10(u16 a1, const struct SaveSectionLocation *location);
 static u8 ClearSaveData_2(u16 a1, const struct SaveSectionLocation *location);
 static u8 TryWriteSector(u8 sector, u8 *data);
 static u8 HandleWriteSector(u16 a1, const struct SaveSectionLocation *location);
+static void CopySectionData(void *dest, const void *src, u16 size);
 
 // Divide save blocks into individual chunks to be written to flash sectors
 
@@ -162,7 +164,6 @@ static u8 SaveWriteToFlash(u16 a1, const struct SaveSectionLocation *location)
 
 static u8 HandleWriteSector(u16 sectorId, const struct SaveSectionLocation *location)
 {
-    u16 i;
     u16 sector;
     u8 *data;
     u16 size;
@@ -175,15 +176,13 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectionLocation *loca
     size = location[sectorId].size;
 
     // clear save section.
-    for (i = 0; i < sizeof(struct SaveSection); i++)
-        ((char *)gFastSaveSection)[i] = 0;
+    CpuFill32(0, gFastSaveSection, sizeof(struct SaveSection));
 
     gFastSaveSection->id = sectorId;
     gFastSaveSection->security = UNKNOWN_CHECK_VALUE;
     gFastSaveSection->counter = gSaveCounter;
 
-    for (i = 0; i < size; i++)
-        gFastSaveSection->data[i] = data[i];
+    CopySectionData(gFastSaveSection->data, data, size);
 
     gFastSaveSection->checksum = CalculateChecksum(data, size);
     return TryWriteSector(sector, gFastSaveSection->data);
@@ -191,16 +190,13 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectionLocation *loca
 
 static u8 HandleWriteSectorNBytes(u8 sector, u8 *data, u16 size)
 {
-    u16 i;
     struct SaveSection *section = &gSaveDataBuffer;
 
-    for (i = 0; i < sizeof(struct SaveSection); i++)
-        ((char *)section)[i] = 0;
+    CpuFill32(0, section, sizeof(struct SaveSection));
 
     section->security = UNKNOWN_CHECK_VALUE;
 
-    for (i = 0; i < size; i++)
-        section->data[i] = data[i];
+    CopySectionData(section->data, data, size);
 
     section->id = CalculateChecksum(data, size); // though this appears to be incorrect, it might be some sector checksum instead of a whole save checksum and only appears to be relevent to HOF data, if used.
     return TryWriteSector(sector, section->data);
@@ -220,6 +216,16 @@ static u8 TryWriteSector(u8 sector, u8 *data)
     }
 }
 
+static void CopySectionData(void *dest, const void *src, u16 size)
+{
+    u16 i;
+    u16 wordSize = size & ~3;
+
+    CpuCopy32(src, dest, wordSize);
+    for (i = wordSize; i < size; i++)
+        ((u8 *)dest)[i] = ((const u8 *)src)[i];
+}
+
 static u32 RestoreSaveBackupVarsAndIncrement(const struct SaveSectionLocation *location) // location is unused
 {
     gFastSaveSection = &gSaveDataBuffer;
@@ -298,16 +304,14 @@ static u8 ClearSaveData_2(u16 sectorId, const struct SaveSectionLocation *locati
     size = location[sectorId].size;
 
     // clear temp save section.
-    for (i = 0; i < sizeof(struct SaveSection); i++)
-        ((char *)gFastSaveSection)[i] = 0;
+    CpuFill32(0, gFastSaveSection, sizeof(struct SaveSection));
 
     gFastSaveSection->id = sectorId;
     gFastSaveSection->security = UNKNOWN_CHECK_VALUE;
     gFastSaveSection->counter = gSaveCounter;
 
     // set temp section's data.
-    for (i = 0; i < size; i++)
-        gFastSaveSection->data[i] = data[i];
+    CopySectionData(gFastSaveSection->data, data, size);
 
     // calculate checksum.
     gFastSaveSection->checksum = CalculateChecksum(data, size);
@@ -459,9 +463,7 @@ static u8 sub_8152E10(u16 a1, const struct SaveSectionLocation *location)
         if (gFastSaveSection->security == UNKNOWN_CHECK_VALUE
          && gFastSaveSection->checksum == checksum)
         {
-            u16 j;
-            for (j = 0; j < location[id].size; j++)
-                ((u8 *)location[id].data)[j] = gFastSaveSection->data[j];
+            CopySectionData(location[id].data, gFastSaveSection->data, location[id].size);
         }
     }
 
@@ -587,7 +589,6 @@ static u8 GetSaveValidStatus(const struct SaveSectionLocation *location)
 
 static u8 sub_81530DC(u8 sectorId, u8 *data, u16 size)
 {
-    u16 i;
     struct SaveSection *section = &gSaveDataBuffer;
     DoReadFlashWholeSection(sectorId, section);
     if (section->security == UNKNOWN_CHECK_VALUE)
@@ -595,8 +596,7 @@ static u8 sub_81530DC(u8 sectorId, u8 *data, u16 size)
         u16 checksum = CalculateChecksum(section->data, size);
         if (section->id == checksum)
         {
-            for (i = 0; i < size; i++)
-                data[i] = section->data[i];
+            CopySectionData(data, section->data, size);
             return SAVE_STATUS_OK;
         }
         else
@@ -810,6 +810,7 @@ u8 Save_LoadGameData(u8 saveType)
     case SAVE_NORMAL:
     default:
         status = sub_8152DD0(0xFFFF, gRamSaveSectionLocations);
+        InvalidateBagItemIndex();
         LoadSerializedGame();
         gSaveFileStatus = status;
         gGameContinueCallback = 0;
@@ -123,6 +123,7 @@ bool8 ScrCmd_special(struct ScriptContext *ctx)
 {
     u16 index = ScriptReadHalfword(ctx);
 
+    ScriptProfiler_CountSpecial(index);
     gSpecials[index]();
     return FALSE;
 }
@@ -130,8 +131,10 @@ bool8 ScrCmd_special(struct ScriptContext *ctx)
 bool8 ScrCmd_specialvar(struct ScriptContext *ctx)
 {
     u16 *var = GetVarPointer(ScriptReadHalfword(ctx));
+    u16 index = ScriptReadHalfword(ctx);
 
-    *var = gSpecials[ScriptReadHalfword(ctx)]();
+    ScriptProfiler_CountSpecial(index);
+    *var = gSpecials[index]();
     return FALSE;
 }
 
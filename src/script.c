@@ -1,6 +1,7 @@
 #include "global.h"
 #include "script.h"
 #include "event_data.h"
+#include "main.h"
 #include "mevent.h"
 #include "util.h"
 #include "constants/map_scripts.h"
@@ -24,6 +25,37 @@ extern ScrCmdFunc gScriptCmdTable[];
 extern ScrCmdFunc gScriptCmdTableEnd[];
 extern void *gNullScriptPtr;
 
+#ifdef SCRIPT_PROFILER
+
+// Times are measured in scanlines, 1232 cycles each.
+#define SCRIPT_PROFILER_MAX_SPECIALS 1024
+#define SCRIPT_PROFILER_MAX_SCRIPTS  64
+
+struct ScriptProfile
+{
+    const u8 *script;
+    u32 commands;
+    u32 scanlines;
+    u32 waitFrames;
+};
+
+extern void *const gSpecials[];
+
+EWRAM_DATA static u32 sScriptCmdCounts[256] = {0};
+EWRAM_DATA static u32 sScriptCmdScanlines[256] = {0};
+EWRAM_DATA static u32 sScriptCmdWaitFrames[256] = {0};
+EWRAM_DATA static u32 sSpecialCounts[SCRIPT_PROFILER_MAX_SPECIALS] = {0};
+EWRAM_DATA static struct ScriptProfile sScriptProfiles[SCRIPT_PROFILER_MAX_SCRIPTS] = {0};
+EWRAM_DATA static bool8 sScriptProfilerPrintInit = FALSE;
+
+static void ScriptProfiler_BeginScript(struct ScriptContext *ctx, const u8 *ptr);
+static void ScriptProfiler_EndCommand(struct ScriptContext *ctx, u8 cmdCode, u32 start);
+static void ScriptProfiler_CountWaitFrame(struct ScriptContext *ctx);
+static void ScriptProfiler_PrintRun(struct ScriptContext *ctx);
+static u32 ScriptProfiler_GetScanline(void);
+
+#endif // SCRIPT_PROFILER
+
 void InitScriptContext(struct ScriptContext *ctx, void *cmdTable, void *cmdTableEnd)
 {
     s32 i;
@@ -40,12 +72,19 @@ void InitScriptContext(struct ScriptContext *ctx, void *cmdTable, void *cmdTable
 
     for (i = 0; i < (int)ARRAY_COUNT(ctx->stack); i++)
         ctx->stack[i] = NULL;
+
+#ifdef SCRIPT_PROFILER
+    ScriptProfiler_BeginScript(ctx, NULL);
+#endif
 }
 
 u8 SetupBytecodeScript(struct ScriptContext *ctx, const u8 *ptr)
 {
     ctx->scriptPtr = ptr;
     ctx->mode = SCRIPT_MODE_BYTECODE;
+#ifdef SCRIPT_PROFILER
+    ScriptProfiler_BeginScript(ctx, ptr);
+#endif
     return 1;
 }
 
@@ -77,6 +116,10 @@ bool8 RunScriptCommand(struct ScriptContext *ctx)
         {
             if (ctx->nativePtr() == TRUE)
                 ctx->mode = SCRIPT_MODE_BYTECODE;
+#ifdef SCRIPT_PROFILER
+            else
+                ScriptProfiler_CountWaitFrame(ctx);
+#endif
             return TRUE;
         }
         ctx->mode = SCRIPT_MODE_BYTECODE;
@@ -86,6 +129,10 @@ bool8 RunScriptCommand(struct ScriptContext *ctx)
         {
             u8 cmdCode;
             ScrCmdFunc *func;
+#ifdef SCRIPT_PROFILER
+            u32 start;
+            bool8 result;
+#endif
 
             if (!ctx->scriptPtr)
             {
@@ -109,8 +156,16 @@ bool8 RunScriptCommand(struct ScriptContext *ctx)
                 return FALSE;
             }
 
+#ifdef SCRIPT_PROFILER
+            start = ScriptProfiler_GetScanline();
+            result = (*func)(ctx);
+            ScriptProfiler_EndCommand(ctx, cmdCode, start);
+            if (result == TRUE)
+                return TRUE;
+#else
             if ((*func)(ctx) == TRUE)
                 return TRUE;
+#endif
         }
     }
 
@@ -126,6 +181,9 @@ static bool8 ScriptPush(struct ScriptContext *ctx, const u8 *ptr)
     else
     {
         ctx->stack[ctx->stackDepth] = ptr;
+#ifdef SCRIPT_PROFILER
+        ctx->profileStack[ctx->stackDepth] = ctx->profileScript;
+#endif
         ctx->stackDepth++;
         return FALSE;
     }
@@ -137,18 +195,27 @@ static const u8 *ScriptPop(struct ScriptContext *ctx)
         return NULL;
 
     ctx->stackDepth--;
+#ifdef SCRIPT_PROFILER
+    ctx->profileScript = ctx->profileStack[ctx->stackDepth];
+#endif
     return ctx->stack[ctx->stackDepth];
 }
 
 void ScriptJump(struct ScriptContext *ctx, const u8 *ptr)
 {
     ctx->scriptPtr = ptr;
+#ifdef SCRIPT_PROFILER
+    ctx->profileScript = ptr;
+#endif
 }
 
 void ScriptCall(struct ScriptContext *ctx, const u8 *ptr)
 {
     ScriptPush(ctx, ctx->scriptPtr);
     ctx->scriptPtr = ptr;
+#ifdef SCRIPT_PROFILER
+    ctx->profileScript = ptr;
+#endif
 }
 
 void ScriptReturn(struct ScriptContext *ctx)
@@ -207,7 +274,12 @@ bool8 ScriptContext2_RunScript(void)
         return FALSE;
 
     if (sScriptContext1Status == 1)
+    {
+#ifdef SCRIPT_PROFILER
+        ScriptProfiler_CountWaitFrame(&sScriptContext1); // blocked in waitstate
+#endif
         return FALSE;
+    }
 
     ScriptContext2_Enable();
 
@@ -215,6 +287,9 @@ bool8 ScriptContext2_RunScript(void)
     {
         sScriptContext1Status = 2;
         ScriptContext2_Disable();
+#ifdef SCRIPT_PROFILER
+        ScriptProfiler_PrintRun(&sScriptContext1);
+#endif
         return FALSE;
     }
 
@@ -444,3 +519,155 @@ void InitRamScript_NoObjectEvent(u8 *script, u16 scriptSize)
         scriptSize = sizeof(gSaveBlock1Ptr->ramScript.data.script);
     InitRamScript(script, scriptSize, 0xFF, 0xFF, 0xFF);
 }
+
+#ifdef SCRIPT_PROFILER
+
+// Scanlines since boot. The frame counter ticks at the start of VBlank, so
+// lines are counted from there to keep the result monotonic.
+static u32 ScriptProfiler_GetScanline(void)
+{
+    u32 vcount, frame;
+
+    do
+    {
+        vcount = REG_VCOUNT;
+        frame = gMain.vblankCounter1;
+    } while (vcount != REG_VCOUNT);
+
+    if (vcount >= DISPLAY_HEIGHT)
+        vcount -= DISPLAY_HEIGHT;
+    else
+        vcount += 228 - DISPLAY_HEIGHT;
+
+    return frame * 228 + vcount;
+}
+
+static struct ScriptProfile *ScriptProfiler_GetProfile(const u8 *script)
+{
+    u32 i, index;
+
+    if (script == NULL)
+        return NULL;
+
+    index = ((u32)script >> 2) % SCRIPT_PROFILER_MAX_SCRIPTS;
+    for (i = 0; i < SCRIPT_PROFILER_MAX_SCRIPTS; i++)
+    {
+        struct ScriptProfile *profile = &sScriptProfiles[index];
+
+        if (profile->script == script)
+            return profile;
+        if (profile->script == NULL)
+        {
+            profile->script = script;
+            return profile;
+        }
+        index = (index + 1) % SCRIPT_PROFILER_MAX_SCRIPTS;
+    }
+
+    return NULL; // table is full, only the per-command totals are kept
+}
+
+static void ScriptProfiler_BeginScript(struct ScriptContext *ctx, const u8 *ptr)
+{
+    ctx->profileEntry = ptr;
+    ctx->profileScript = ptr;
+    ctx->profileRunStart = ScriptProfiler_GetScanline();
+    ctx->profileRunCommands = 0;
+    ctx->profileRunScanlines = 0;
+    ctx->profileLastCmd = 0;
+}
+
+static void ScriptProfiler_EndCommand(struct ScriptContext *ctx, u8 cmdCode, u32 start)
+{
+    u32 scanlines = ScriptProfiler_GetScanline() - start;
+    struct ScriptProfile *profile = ScriptProfiler_GetProfile(ctx->profileScript);
+
+    sScriptCmdCounts[cmdCode]++;
+    sScriptCmdScanlines[cmdCode] += scanlines;
+    ctx->profileRunCommands++;
+    ctx->profileRunScanlines += scanlines;
+    ctx->profileLastCmd = cmdCode;
+    if (profile != NULL)
+    {
+        profile->commands++;
+        profile->scanlines += scanlines;
+    }
+}
+
+// A frame spent waiting on the last command, e.g. waitstate or waitmovement.
+static void ScriptProfiler_CountWaitFrame(struct ScriptContext *ctx)
+{
+    struct ScriptProfile *profile = ScriptProfiler_GetProfile(ctx->profileScript);
+
+    sScriptCmdWaitFrames[ctx->profileLastCmd]++;
+    if (profile != NULL)
+        profile->waitFrames++;
+}
+
+void ScriptProfiler_CountSpecial(u16 index)
+{
+    if (index < SCRIPT_PROFILER_MAX_SPECIALS)
+        sSpecialCounts[index]++;
+}
+
+static void ScriptProfiler_InitPrint(void)
+{
+    if (!sScriptProfilerPrintInit)
+    {
+        AGBPrintInit();
+        sScriptProfilerPrintInit = TRUE;
+    }
+}
+
+static void ScriptProfiler_PrintRun(struct ScriptContext *ctx)
+{
+    ScriptProfiler_InitPrint();
+    AGBPrintf("SCRPROF run %08X frames=%u cmds=%u lines=%u\n",
+              (u32)ctx->profileEntry,
+              (ScriptProfiler_GetScanline() - ctx->profileRunStart) / 228,
+              ctx->profileRunCommands,
+              ctx->profileRunScanlines);
+}
+
+#endif // SCRIPT_PROFILER
+
+// Prints the collected counters through AGBPrint. Handler, special and script
+// addresses can be turned back into names with tools/scriptprof.
+void ScriptProfilerReport(void)
+{
+#ifdef SCRIPT_PROFILER
+    u32 i;
+
+    ScriptProfiler_InitPrint();
+    for (i = 0; i < (u32)(gScriptCmdTableEnd - gScriptCmdTable); i++)
+    {
+        if (sScriptCmdCounts[i] != 0 || sScriptCmdWaitFrames[i] != 0)
+            AGBPrintf("SCRPROF cmd %02X %08X count=%u lines=%u wait=%u\n",
+                      i, (u32)gScriptCmdTable[i], sScriptCmdCounts[i], sScriptCmdScanlines[i], sScriptCmdWaitFrames[i]);
+    }
+    for (i = 0; i < SCRIPT_PROFILER_MAX_SPECIALS; i++)
+    {
+        if (sSpecialCounts[i] != 0)
+            AGBPrintf("SCRPROF special %u %08X count=%u\n", i, (u32)gSpecials[i], sSpecialCounts[i]);
+    }
+    for (i = 0; i < SCRIPT_PROFILER_MAX_SCRIPTS; i++)
+    {
+        if (sScriptProfiles[i].script != NULL)
+            AGBPrintf("SCRPROF script %08X cmds=%u lines=%u wait=%u\n",
+                      (u32)sScriptProfiles[i].script, sScriptProfiles[i].commands, sScriptProfiles[i].scanlines, sScriptProfiles[i].waitFrames);
+    }
+    AGBPrintFlush();
+#endif
+}
+
+// Clears the collected counters, so a report only covers what ran after this.
+void ScriptProfilerReset(void)
+{
+#ifdef SCRIPT_PROFILER
+    CpuFill32(0, sScriptCmdCounts, sizeof(sScriptCmdCounts));
+    CpuFill32(0, sScriptCmdScanlines, sizeof(sScriptCmdScanlines));
+    CpuFill32(0, sScriptCmdWaitFrames, sizeof(sScriptCmdWaitFrames));
+    CpuFill32(0, sSpecialCounts, sizeof(sSpecialCounts));
+    CpuFill32(0, sScriptProfiles, sizeof(sScriptProfiles));
+#endif
+}
@@ -6,6 +6,8 @@
 #include "task.h"
 #include "battle_transition.h"
 #include "fieldmap.h"
+#include "overworld.h"
+#include "tileset_anims.h"
 
 static EWRAM_DATA struct {
     const u16 *src;
@@ -13,6 +15,23 @@ static EWRAM_DATA struct {
     u16 size;
 } sTilesetDMA3TransferBuffer[20] = {0};
 
+// Every VRAM destination an animation has written to since the tilesets were loaded, with the
+// frame it last asked for and the frame actually in VRAM. Frames are only uploaded when they
+// differ from what's already there, and only while some tile in their range is on the BG maps.
+// A frame skipped while out of view is uploaded as soon as the range becomes visible again.
+#define MAX_TILESET_ANIM_DESTS 24
+
+static EWRAM_DATA struct {
+    const u16 *src;
+    const u16 *uploadedSrc;
+    u16 *dest;
+    u16 size;
+} sTilesetAnimDests[MAX_TILESET_ANIM_DESTS] = {0};
+
+static EWRAM_DATA u8 sTilesetAnimDestsCount = 0;
+static EWRAM_DATA bool8 sVisibleAnimTilesDirty = FALSE;
+static EWRAM_DATA u32 sVisibleAnimTiles[NUM_TILES_TOTAL / 32] = {0};
+
 static u8 sTilesetDMA3TransferBufferSize;
 static u16 sPrimaryTilesetAnimCounter;
 static u16 sPrimaryTilesetAnimCounterMax;
@@ -22,6 +41,10 @@ static void (*sPrimaryTilesetAnimCallback)(u16);
 static void (*sSecondaryTilesetAnimCallback)(u16);
 
 static void _InitPrimaryTilesetAnimation(void);
+static void ResetTilesetAnimDests(void);
+static void UpdateVisibleAnimTiles(void);
+static bool8 AreAnimTilesVisible(const u16 *dest, u16 size);
+static void QueueChangedTilesetAnims(void);
 static void _InitSecondaryTilesetAnimation(void);
 static void TilesetAnim_General(u16);
 static void TilesetAnim_Building(u16);
@@ -550,14 +573,108 @@ static void ResetTilesetAnimBuffer(void)
     CpuFill32(0, sTilesetDMA3TransferBuffer, sizeof sTilesetDMA3TransferBuffer);
 }
 
+static void ResetTilesetAnimDests(void)
+{
+    sTilesetAnimDestsCount = 0;
+    sVisibleAnimTilesDirty = TRUE;
+}
+
+// Called whenever the field BG tilemaps are redrawn
+void InvalidateVisibleAnimTiles(void)
+{
+    sVisibleAnimTilesDirty = TRUE;
+}
+
+static void UpdateVisibleAnimTiles(void)
+{
+    s32 i;
+    u16 tile;
+
+    if (!sVisibleAnimTilesDirty)
+        return;
+    sVisibleAnimTilesDirty = FALSE;
+
+    for (i = 0; i < (s32)ARRAY_COUNT(sVisibleAnimTiles); i++)
+        sVisibleAnimTiles[i] = 0;
+
+    for (i = 0; i < BG_SCREEN_SIZE / 2; i++)
+    {
+        tile = gBGTilemapBuffers1[i] & 0x3FF;
+        sVisibleAnimTiles[tile / 32] |= 1 << (tile % 32);
+        tile = gBGTilemapBuffers2[i] & 0x3FF;
+        sVisibleAnimTiles[tile / 32] |= 1 << (tile % 32);
+        tile = gBGTilemapBuffers3[i] & 0x3FF;
+        sVisibleAnimTiles[tile / 32] |= 1 << (tile % 32);
+    }
+}
+
+static bool8 AreAnimTilesVisible(const u16 *dest, u16 size)
+{
+    u32 tile = ((u32)dest - BG_VRAM) / TILE_SIZE_4BPP;
+    u32 end = tile + size / TILE_SIZE_4BPP;
+
+    // Outside the field (e.g. while the tilemaps are freed) assume everything is visible
+    if (gBGTilemapBuffers1 == NULL || gBGTilemapBuffers2 == NULL || gBGTilemapBuffers3 == NULL)
+        return TRUE;
+
+    UpdateVisibleAnimTiles();
+    for (; tile < end && tile < NUM_TILES_TOTAL; tile++)
+    {
+        if (sVisibleAnimTiles[tile / 32] & (1 << (tile % 32)))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+// Records the frame an animation wants at dest. Uploads are queued by QueueChangedTilesetAnims.
 static void AppendTilesetAnimToBuffer(const u16 *src, u16 *dest, u16 size)
 {
-    if (sTilesetDMA3TransferBufferSize < 20)
+    u32 i;
+
+    for (i = 0; i < sTilesetAnimDestsCount; i++)
+    {
+        if (sTilesetAnimDests[i].dest == dest && sTilesetAnimDests[i].size == size)
+            break;
+    }
+
+    if (i == sTilesetAnimDestsCount)
+    {
+        if (sTilesetAnimDestsCount >= MAX_TILESET_ANIM_DESTS)
+        {
+            // Untracked, upload it unconditionally as before
+            if (sTilesetDMA3TransferBufferSize < ARRAY_COUNT(sTilesetDMA3TransferBuffer))
+            {
+                sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].src = src;
+                sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].dest = dest;
+                sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].size = size;
+                sTilesetDMA3TransferBufferSize++;
+            }
+            return;
+        }
+        sTilesetAnimDests[i].uploadedSrc = NULL;
+        sTilesetAnimDests[i].dest = dest;
+        sTilesetAnimDests[i].size = size;
+        sTilesetAnimDestsCount++;
+    }
+    sTilesetAnimDests[i].src = src;
+}
+
+static void QueueChangedTilesetAnims(void)
+{
+    u32 i;
+
+    for (i = 0; i < sTilesetAnimDestsCount && sTilesetDMA3TransferBufferSize < ARRAY_COUNT(sTilesetDMA3TransferBuffer); i++)
     {
-        sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].src = src;
-        sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].dest = dest;
-        sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].size = size;
-        sTilesetDMA3TransferBufferSize ++;
+        if (sTilesetAnimDests[i].src == sTilesetAnimDests[i].uploadedSrc)
+            continue;
+        if (!AreAnimTilesVisible(sTilesetAnimDests[i].dest, sTilesetAnimDests[i].size))
+            continue;
+
+        sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].src = sTilesetAnimDests[i].src;
+        sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].dest = sTilesetAnimDests[i].dest;
+        sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].size = sTilesetAnimDests[i].size;
+        sTilesetDMA3TransferBufferSize++;
+        sTilesetAnimDests[i].uploadedSrc = sTilesetAnimDests[i].src;
     }
 }
 
@@ -574,12 +691,15 @@ void TransferTilesetAnimsBuffer(void)
 void InitTilesetAnimations(void)
 {
     ResetTilesetAnimBuffer();
+    ResetTilesetAnimDests();
     _InitPrimaryTilesetAnimation();
     _InitSecondaryTilesetAnimation();
 }
 
 void InitSecondaryTilesetAnimation(void)
 {
+    // The secondary tiles in VRAM were just replaced, so nothing can be assumed uploaded
+    ResetTilesetAnimDests();
     _InitSecondaryTilesetAnimation();
 }
 
@@ -595,6 +715,7 @@ void UpdateTilesetAnimations(void)
         sPrimaryTilesetAnimCallback(sPrimaryTilesetAnimCounter);
     if (sSecondaryTilesetAnimCallback)
         sSecondaryTilesetAnimCallback(sSecondaryTilesetAnimCounter);
+    QueueChangedTilesetAnims();
 }
 
 static void _InitPrimaryTilesetAnimation(void)
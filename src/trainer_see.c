@@ -23,6 +23,7 @@
 static u8 CheckTrainer(u8 objectEventId);
 static u8 GetTrainerApproachDistance(struct ObjectEvent *trainerObj);
 static u8 CheckPathBetweenTrainerAndPlayer(struct ObjectEvent *trainerObj, u8 approachDistance, u8 direction);
+static u8 GetTrainerSightClearTiles(struct ObjectEvent *trainerObj, u8 direction);
 static void InitTrainerApproachTask(struct ObjectEvent *trainerObj, u8 range);
 static void Task_RunTrainerSeeFuncList(u8 taskId);
 static void Task_EndTrainerApproach(u8 taskId);
@@ -58,6 +59,22 @@ bool8 gTrainerApproachedPlayer;
 // EWRAM
 EWRAM_DATA u8 gApproachingTrainerId = 0;
 
+// How far each trainer can see in each direction before the map itself blocks the view,
+// so a step only has to check the tiles in between for objects. Entries are keyed by the
+// trainer's position and elevation, and all of them are dropped when the map grid changes.
+struct TrainerSight
+{
+    u32 generation;
+    s16 x;
+    s16 y;
+    u8 elevation;
+    u8 range;
+    u8 clearTiles[4]; // +1, 0 if not computed yet
+};
+
+static EWRAM_DATA struct TrainerSight sTrainerSight[OBJECT_EVENTS_COUNT] = {0};
+static EWRAM_DATA u32 sTrainerSightGeneration = 0;
+
 // const rom data
 static const u8 sEmotion_ExclamationMarkGfx[] = INCBIN_U8("graphics/misc/emotion_exclamation.4bpp");
 static const u8 sEmotion_QuestionMarkGfx[] = INCBIN_U8("graphics/misc/emotion_question.4bpp");
@@ -251,6 +268,11 @@ static u8 CheckTrainer(u8 objectEventId)
     u8 numTrainers = 1;
     u8 approachDistance;
 
+    // Most trainers can't see the player at all, so rule that out before looking up their flags
+    approachDistance = GetTrainerApproachDistance(&gObjectEvents[objectEventId]);
+    if (approachDistance == 0)
+        return 0;
+
     if (InTrainerHill() == TRUE)
         scriptPtr = GetTrainerHillTrainerScript();
     else
@@ -272,30 +294,23 @@ static u8 CheckTrainer(u8 objectEventId)
             return 0;
     }
 
-    approachDistance = GetTrainerApproachDistance(&gObjectEvents[objectEventId]);
-
-    if (approachDistance != 0)
+    if (scriptPtr[1] == TRAINER_BATTLE_DOUBLE
+        || scriptPtr[1] == TRAINER_BATTLE_REMATCH_DOUBLE
+        || scriptPtr[1] == TRAINER_BATTLE_CONTINUE_SCRIPT_DOUBLE)
     {
-        if (scriptPtr[1] == TRAINER_BATTLE_DOUBLE
-            || scriptPtr[1] == TRAINER_BATTLE_REMATCH_DOUBLE
-            || scriptPtr[1] == TRAINER_BATTLE_CONTINUE_SCRIPT_DOUBLE)
-        {
-            if (GetMonsStateToDoubles_2() != 0)
-                return 0;
-
-            numTrainers = 2;
-        }
-
-        gApproachingTrainers[gNoOfApproachingTrainers].objectEventId = objectEventId;
-        gApproachingTrainers[gNoOfApproachingTrainers].trainerScriptPtr = scriptPtr;
-        gApproachingTrainers[gNoOfApproachingTrainers].radius = approachDistance;
-        InitTrainerApproachTask(&gObjectEvents[objectEventId], approachDistance - 1);
-        gNoOfApproachingTrainers++;
+        if (GetMonsStateToDoubles_2() != 0)
+            return 0;
 
-        return numTrainers;
+        numTrainers = 2;
     }
 
-    return 0;
+    gApproachingTrainers[gNoOfApproachingTrainers].objectEventId = objectEventId;
+    gApproachingTrainers[gNoOfApproachingTrainers].trainerScriptPtr = scriptPtr;
+    gApproachingTrainers[gNoOfApproachingTrainers].radius = approachDistance;
+    InitTrainerApproachTask(&gObjectEvents[objectEventId], approachDistance - 1);
+    gNoOfApproachingTrainers++;
+
+    return numTrainers;
 }
 
 static u8 GetTrainerApproachDistance(struct ObjectEvent *trainerObj)
@@ -369,6 +384,53 @@ static u8 GetTrainerApproachDistanceEast(struct ObjectEvent *trainerObj, s16 ran
 
 #define COLLISION_MASK (~1)
 
+void InvalidateTrainerSightCache(void)
+{
+    sTrainerSightGeneration++;
+}
+
+// Returns how many tiles in front of the trainer in the given direction are free of map
+// collisions, up to its sight range. Other objects aren't included, they move too often.
+static u8 GetTrainerSightClearTiles(struct ObjectEvent *trainerObj, u8 direction)
+{
+    struct TrainerSight *sight = &sTrainerSight[trainerObj - gObjectEvents];
+    s16 x, y;
+    u8 i;
+    u8 collision;
+
+    if (sight->generation != sTrainerSightGeneration
+     || sight->x != trainerObj->currentCoords.x
+     || sight->y != trainerObj->currentCoords.y
+     || sight->elevation != trainerObj->currentElevation
+     || sight->range != trainerObj->trainerRange_berryTreeId)
+    {
+        sight->generation = sTrainerSightGeneration;
+        sight->x = trainerObj->currentCoords.x;
+        sight->y = trainerObj->currentCoords.y;
+        sight->elevation = trainerObj->currentElevation;
+        sight->range = trainerObj->trainerRange_berryTreeId;
+        for (i = 0; i < ARRAY_COUNT(sight->clearTiles); i++)
+            sight->clearTiles[i] = 0;
+    }
+
+    if (sight->clearTiles[direction - 1] == 0)
+    {
+        x = trainerObj->currentCoords.x;
+        y = trainerObj->currentCoords.y;
+        MoveCoords(direction, &x, &y);
+        for (i = 0; i < sight->range; i++, MoveCoords(direction, &x, &y))
+        {
+            // GetCollisionFlagsAtCoords sets bit (COLLISION_* - 1) for each collision found
+            collision = GetCollisionFlagsAtCoords(trainerObj, x, y, direction) & ~(1 << (COLLISION_OBJECT_EVENT - 1));
+            if (collision != 0 && (collision & COLLISION_MASK))
+                break;
+        }
+        sight->clearTiles[direction - 1] = i + 1;
+    }
+
+    return sight->clearTiles[direction - 1] - 1;
+}
+
 static u8 CheckPathBetweenTrainerAndPlayer(struct ObjectEvent *trainerObj, u8 approachDistance, u8 direction)
 {
     s16 x, y;
@@ -379,14 +441,16 @@ static u8 CheckPathBetweenTrainerAndPlayer(struct ObjectEvent *trainerObj, u8 ap
     if (approachDistance == 0)
         return 0;
 
+    if (GetTrainerSightClearTiles(trainerObj, direction) < approachDistance - 1)
+        return 0;
+
     x = trainerObj->currentCoords.x;
     y = trainerObj->currentCoords.y;
 
     MoveCoords(direction, &x, &y);
     for (i = 0; i < approachDistance - 1; i++, MoveCoords(direction, &x, &y))
     {
-        collision = GetCollisionFlagsAtCoords(trainerObj, x, y, direction);
-        if (collision != 0 && (collision & COLLISION_MASK))
+        if (DoesObjectCollideWithObjectAt(trainerObj, x, y))
             return 0;
     }
 
@@ -0,0 +1,163 @@
+#include "global.h"
+#include "wild_encounter.h"
+#include "pokemon.h"
+#include "random.h"
+#include "event_data.h"
+#include "battle_ai_util.h"
+#include "constants/flags.h"
+
+struct RandomizerWildEncounter
+{
+    u16 species;
+    u16 bst; // raised to RANDOMIZER_MIN_BST
+    u16 finalEvoBST;
+    u16 index; // position in the species list the table was generated from
+    u32 typeMask;
+};
+
+// sWildEncountersByBST: every species the randomizer can pick, sorted by BST and then by list order.
+// sWildEncounterPositions: the position of each list entry in sWildEncountersByBST.
+#include "data/wild_encounter_randomizer_table.h"
+
+// Returns the first position in sWildEncountersByBST whose BST is at least bst,
+// or above bst if inclusive is FALSE.
+static u16 FindWildEncounterBSTBound(u16 bst, bool8 inclusive)
+{
+    u16 lo = 0, hi = ARRAY_COUNT(sWildEncountersByBST), mid;
+
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (sWildEncountersByBST[mid].bst < bst || (!inclusive && sWildEncountersByBST[mid].bst == bst))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+u16 GetRandomWildEncounterWithBST(u16 species)
+{
+    u16 maxBST = 400;
+    u16 rand = 0;
+    u16 i = 0;
+    u16 j = 0;
+    u16 speciesBST = GetTotalBaseStat(species);
+    u16 minTargetBST = 0;
+    u16 maxTargetBST = 0;
+    u16 maxEvoBST = 500;
+    u16 start, end, index;
+    u32 typeMask;
+    const struct RandomizerWildEncounter *encounter;
+    bool8 keepType = FALSE;
+    u8 increment = 25;
+
+    // One bit per species list entry that made it into the candidate list
+    u32 speciesInBSTRange[(ARRAY_COUNT(sWildEncountersByBST) + 31) / 32];
+
+
+    // Check player's progression to update maxBST (400 + increment for each badge) // no limit after E4
+    if (FlagGet(FLAG_BADGE01_GET))
+    {
+        maxBST += increment;
+        maxEvoBST += increment;
+    }
+    if (FlagGet(FLAG_BADGE02_GET))
+    {
+        maxBST += increment;
+        maxEvoBST += increment;
+    }
+    if (FlagGet(FLAG_BADGE03_GET))
+    {
+        maxBST += increment;
+        maxEvoBST += increment;
+    }
+    if (FlagGet(FLAG_BADGE04_GET))
+    {
+        maxBST += increment;
+        maxEvoBST += increment;
+    }
+    if (FlagGet(FLAG_BADGE05_GET))
+        maxBST += increment;
+    if (FlagGet(FLAG_BADGE06_GET))
+        maxBST += increment;
+    if (FlagGet(FLAG_BADGE07_GET))
+        maxBST += increment;
+    if (FlagGet(FLAG_BADGE08_GET))
+        maxBST += increment;
+    if (FlagGet(FLAG_SYS_GAME_CLEAR))
+    {
+        maxBST += 5000;
+        maxEvoBST += 5000;
+    }
+
+
+    if (speciesBST < RANDOMIZER_MIN_BST) // increase early game variety and reduce chance to abuse Cosmog and Feebas
+        speciesBST = RANDOMIZER_MIN_BST;
+
+    // set minTargetBST and maxTargetBST
+    if (speciesBST - increment >= 6) // theorically useless
+        minTargetBST = speciesBST - increment;
+    else
+        return species; // cope
+
+    if (speciesBST + increment > maxBST)
+        if (speciesBST > maxBST)
+        {
+            keepType = TRUE; // Will force random encounters to share both types with species
+            maxTargetBST = speciesBST;
+        }
+        else
+            maxTargetBST = maxBST;
+    else
+        maxTargetBST = speciesBST + increment;
+
+
+    // Dynamically updated allowedWildEncounter to contain all Pokemon within the speciesBST +/- increment (up to maxBST)
+    // or speciesBST-increment/speciesBST and share one type with species if speciesBST is above maxBST.
+    // Only the sorted window [minTargetBST, maxTargetBST] is looked up, species itself always falls inside it.
+    start = FindWildEncounterBSTBound(minTargetBST, TRUE);
+    end = FindWildEncounterBSTBound(maxTargetBST, FALSE);
+    typeMask = (1 << gBaseStats[species].type1) | (1 << gBaseStats[species].type2);
+    memset(speciesInBSTRange, 0, sizeof(speciesInBSTRange));
+
+    for (i = start; i < end; i++)
+    {
+        encounter = &sWildEncountersByBST[i];
+        if (species == encounter->species || !keepType || (typeMask & encounter->typeMask)) // keepType needs a type in common
+            speciesInBSTRange[encounter->index / 32] |= 1 << (encounter->index % 32);
+    }
+
+    // Walk the marked entries in list order, so the Random() draws below and the
+    // final pick are the same as with a walk of the whole list.
+    for (index = 0; index < ARRAY_COUNT(sWildEncounterPositions); index++)
+    {
+        if (!(speciesInBSTRange[index / 32] & (1 << (index % 32))))
+            continue;
+
+        encounter = &sWildEncountersByBST[sWildEncounterPositions[index]];
+        if (species == encounter->species)
+        {
+            j++;
+            continue;
+        }
+
+        if (encounter->finalEvoBST <= maxEvoBST
+         || Random() % ((encounter->finalEvoBST - maxBST) + maxBST/10) < maxBST/10) // reduce the chance to get a stronger pokemon early game
+            j++;
+        else
+            speciesInBSTRange[index / 32] &= ~(1 << (index % 32));
+    }
+    if (j <= 1) //theorically useless
+        return species; // cope
+
+    // Choose and return random species
+    rand = Random() % j;
+    for (index = 0; index < ARRAY_COUNT(sWildEncounterPositions); index++)
+    {
+        if ((speciesInBSTRange[index / 32] & (1 << (index % 32))) && rand-- == 0)
+            break;
+    }
+    return sWildEncountersByBST[sWildEncounterPositions[index]].species;
+}
@@ -0,0 +1,350 @@
+// indexcheck: checks the lookup tables lookupgen generates, and the game code
+// that reads them, against the table scans they replaced
+//
+// Usage: make check (from the top-level directory, which generates the tables)
+//
+// This program is built on the host against the real species data and the
+// game's lookup code. It runs that code next to a copy of the old scan for
+// every species and prints every difference. The exit status is 1 if there
+// was any difference.
+
+#include "global.h"
+#include "pokemon.h"
+#include "daycare.h"
+#include "wild_encounter.h"
+#include "random.h"
+#include "event_data.h"
+#include "battle_ai_util.h"
+#include "constants/abilities.h"
+#include "constants/daycare.h"
+#include "constants/flags.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/species.h"
+#include <stdio.h>
+
+#include "data/pokemon/base_stats.h"
+#include "data/pokemon/evolution.h"
+#include "data/pokemon/evolution_families.h"
+#include "data/pokemon/egg_moves.h"
+#include "data/pokemon/egg_moves_index.h"
+#include "data/wild_encounter_randomizer_species.h"
+
+#define SEED_COUNT 4
+#define BADGE_COUNT 8
+
+u32 gRngValue;
+
+static u8 sBadges;
+static bool8 sGameClear;
+static int sFailures;
+
+u16 Random(void)
+{
+    gRngValue = ISO_RANDOMIZE1(gRngValue);
+    return gRngValue >> 16;
+}
+
+bool8 FlagGet(u16 id)
+{
+    if (id == FLAG_SYS_GAME_CLEAR)
+        return sGameClear;
+    return id >= FLAG_BADGE01_GET && id < FLAG_BADGE01_GET + sBadges;
+}
+
+u32 GetTotalBaseStat(u32 species)
+{
+    return gBaseStats[species].baseHP
+        + gBaseStats[species].baseAttack
+        + gBaseStats[species].baseDefense
+        + gBaseStats[species].baseSpeed
+        + gBaseStats[species].baseSpAttack
+        + gBaseStats[species].baseSpDefense;
+}
+
+
+static void Fail(const char *what, u16 species, u32 expected, u32 actual)
+{
+    printf("%s: species %u: expected %u, got %u\n", what, species, expected, actual);
+    sFailures++;
+}
+
+// GetEggMoves from src/daycare.c, from before sEggMovesIndex.
+static u8 OldGetEggMoves(u16 species, u16 *eggMoves)
+{
+    u16 eggMoveIdx = 0;
+    u16 numEggMoves = 0;
+    u16 i;
+
+    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
+    {
+        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
+        {
+            eggMoveIdx = i + 1;
+            break;
+        }
+    }
+
+    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
+    {
+        if (gEggMoves[eggMoveIdx + i] > EGG_MOVES_SPECIES_OFFSET)
+            break;
+
+        eggMoves[i] = gEggMoves[eggMoveIdx + i];
+        numEggMoves++;
+    }
+
+    return numEggMoves;
+}
+
+// sEggMovesIndex points every species at the egg moves the old scan found.
+static void CheckEggMoves(void)
+{
+    u16 expected[EGG_MOVES_ARRAY_COUNT];
+    u8 numExpected;
+    u16 species, offset;
+    int i;
+
+    for (species = 1; species < NUM_SPECIES; species++)
+    {
+        numExpected = OldGetEggMoves(species, expected);
+        if (sEggMovesIndex[species].count != numExpected)
+        {
+            Fail("sEggMovesIndex count", species, numExpected, sEggMovesIndex[species].count);
+            continue;
+        }
+        offset = sEggMovesIndex[species].offset;
+        for (i = 0; i < numExpected; i++)
+        {
+            if (gEggMoves[offset + i] != expected[i])
+                Fail("sEggMovesIndex move", species, expected[i], gEggMoves[offset + i]);
+        }
+    }
+}
+
+// GetEggSpecies from src/daycare.c, from before gEvolutionFamily. steps is set
+// to the number of pre-evolutions it walked back through.
+static u16 OldGetEggSpecies(u16 species, u8 *steps)
+{
+    int i, j, k;
+    bool8 found;
+
+    for (i = 0; i < EVOS_PER_MON; i++)
+    {
+        found = FALSE;
+        for (j = 1; j < NUM_SPECIES; j++)
+        {
+            for (k = 0; k < EVOS_PER_MON; k++)
+            {
+                if (gEvolutionTable[j][k].targetSpecies == species)
+                {
+                    species = j;
+                    found = TRUE;
+                    break;
+                }
+            }
+
+            if (found)
+                break;
+        }
+
+        if (j == NUM_SPECIES)
+            break;
+    }
+
+    *steps = i;
+    return species;
+}
+
+// The lowest species id that evolves into species, found by scanning gEvolutionTable.
+static u16 OldGetPreEvolution(u16 species)
+{
+    int j, k;
+
+    for (j = 1; j < NUM_SPECIES; j++)
+    {
+        for (k = 0; k < EVOS_PER_MON; k++)
+        {
+            if (gEvolutionTable[j][k].targetSpecies == species)
+                return j;
+        }
+    }
+
+    return SPECIES_NONE;
+}
+
+static void CheckEvolutionFamilies(void)
+{
+    u16 species, expected;
+    u8 stage;
+
+    for (species = 1; species < NUM_SPECIES; species++)
+    {
+        expected = OldGetPreEvolution(species);
+        if (gPreEvolutionTable[species] != expected)
+            Fail("gPreEvolutionTable", species, expected, gPreEvolutionTable[species]);
+
+        expected = OldGetEggSpecies(species, &stage);
+        if (gEvolutionFamily[species].root != expected)
+            Fail("gEvolutionFamily root", species, expected, gEvolutionFamily[species].root);
+        if (gEvolutionFamily[species].stage != stage)
+            Fail("gEvolutionFamily stage", species, stage, gEvolutionFamily[species].stage);
+    }
+}
+
+// getSpeciesFinalEvo and the randomizer's full table walk from src/wild_encounter.c,
+// from before the generated BST table.
+static u16 OldGetSpeciesFinalEvo(u16 species)
+{
+    u8 i;
+
+    for (i = 0; i < 5; i++)
+    {
+        if (gEvolutionTable[species][0].method != 0 && gEvolutionTable[species][0].method != EVO_MEGA_EVOLUTION)
+            species = gEvolutionTable[species][0].targetSpecies;
+    }
+    return species;
+}
+
+static u16 OldGetRandomWildEncounterWithBST(u16 species)
+{
+    static u16 candidates[ARRAY_COUNT(possibleWildEncounter)];
+    u16 maxBST = 400;
+    u16 maxEvoBST = 500;
+    u16 speciesBST = GetTotalBaseStat(species);
+    u16 minTargetBST, maxTargetBST;
+    u16 targetSpecies, targetSpeciesBST, targetSpeciesFinalEvoBST;
+    bool8 keepType = FALSE;
+    u16 i, j = 0;
+
+    for (i = 0; i < BADGE_COUNT; i++)
+    {
+        if (FlagGet(FLAG_BADGE01_GET + i))
+        {
+            maxBST += 25;
+            if (i < 4)
+                maxEvoBST += 25;
+        }
+    }
+    if (FlagGet(FLAG_SYS_GAME_CLEAR))
+    {
+        maxBST += 5000;
+        maxEvoBST += 5000;
+    }
+
+    if (speciesBST < 250)
+        speciesBST = 250;
+    if (speciesBST - 25 >= 6)
+        minTargetBST = speciesBST - 25;
+    else
+        return species;
+    if (speciesBST + 25 > maxBST)
+    {
+        if (speciesBST > maxBST)
+        {
+            keepType = TRUE;
+            maxTargetBST = speciesBST;
+        }
+        else
+        {
+            maxTargetBST = maxBST;
+        }
+    }
+    else
+    {
+        maxTargetBST = speciesBST + 25;
+    }
+
+    for (i = 0; i < ARRAY_COUNT(possibleWildEncounter); i++)
+    {
+        targetSpecies = possibleWildEncounter[i][0];
+        targetSpeciesBST = GetTotalBaseStat(targetSpecies);
+        targetSpeciesFinalEvoBST = GetTotalBaseStat(OldGetSpeciesFinalEvo(targetSpecies));
+        if (targetSpeciesBST < 250)
+            targetSpeciesBST = 250;
+
+        if (species == targetSpecies)
+        {
+            candidates[j++] = targetSpecies;
+            continue;
+        }
+        if (keepType
+         && !(gBaseStats[species].type1 == gBaseStats[targetSpecies].type1
+           || gBaseStats[species].type1 == gBaseStats[targetSpecies].type2
+           || gBaseStats[species].type2 == gBaseStats[targetSpecies].type1
+           || gBaseStats[species].type2 == gBaseStats[targetSpecies].type2))
+            continue;
+
+        if (targetSpeciesBST >= minTargetBST && targetSpeciesBST <= maxTargetBST)
+        {
+            if (targetSpeciesFinalEvoBST <= maxEvoBST)
+                candidates[j++] = targetSpecies;
+            else if (Random() % ((targetSpeciesFinalEvoBST - maxBST) + maxBST / 10) < maxBST / 10)
+                candidates[j++] = targetSpecies;
+        }
+    }
+    if (j <= 1)
+        return species;
+
+    return candidates[Random() % j];
+}
+
+// Same species and the same number of Random() draws for every species, seed
+// and badge count.
+static void CheckWildEncounterRandomizer(void)
+{
+    static const u32 seeds[SEED_COUNT] = {0, 1, 0x12345678, 0xDEADBEEF};
+    u32 seed, rngAfterOld;
+    u16 species, expected, actual;
+    int i;
+
+    for (sGameClear = FALSE; sGameClear <= TRUE; sGameClear++)
+    {
+        for (sBadges = 0; sBadges <= BADGE_COUNT; sBadges++)
+        {
+            for (species = 1; species < NUM_SPECIES; species++)
+            {
+                for (i = 0; i < SEED_COUNT; i++)
+                {
+                    seed = seeds[i];
+                    gRngValue = seed;
+                    expected = OldGetRandomWildEncounterWithBST(species);
+                    rngAfterOld = gRngValue;
+                    gRngValue = seed;
+                    actual = GetRandomWildEncounterWithBST(species);
+                    if (actual != expected)
+                        Fail("GetRandomWildEncounterWithBST", species, expected, actual);
+                    else if (gRngValue != rngAfterOld)
+                        Fail("GetRandomWildEncounterWithBST rng state", species, rngAfterOld, gRngValue);
+                }
+            }
+        }
+    }
+}
+
+static void CheckFinalEvolution(void)
+{
+    u16 species;
+
+    for (species = 1; species < NUM_SPECIES; species++)
+    {
+        if (gEvolutionFamily[species].final != OldGetSpeciesFinalEvo(species))
+            Fail("gEvolutionFamily final", species, OldGetSpeciesFinalEvo(species), gEvolutionFamily[species].final);
+    }
+}
+
+int main(void)
+{
+    CheckEggMoves();
+    CheckEvolutionFamilies();
+    CheckFinalEvolution();
+    CheckWildEncounterRandomizer();
+
+    if (sFailures != 0)
+    {
+        printf("%d mismatches\n", sFailures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,223 @@
+// lookupgen: precomputes species lookup tables that the game would otherwise
+// build by scanning its data tables
+//
+// Usage: lookupgen TABLE OUTPUT_FILE
+//
+// TABLE is one of:
+//   eggmoves    where each species' egg moves are in gEggMoves
+//   evolution   each species' pre-evolution and evolution family
+//   randomizer  the wild encounter randomizer's species list, sorted by BST
+//
+// This program is built against the game's own headers and species data, so
+// the tables always match what the ROM is built from. The Makefile relinks it
+// whenever that data changes and then writes each table to src/data/.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "global.h"
+#include "pokemon.h"
+#include "wild_encounter.h"
+#include "constants/daycare.h"
+#include "constants/abilities.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/species.h"
+
+#include "data/pokemon/base_stats.h"
+#include "data/pokemon/evolution.h"
+#include "data/pokemon/egg_moves.h"
+#include "data/wild_encounter_randomizer_species.h"
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+struct RandomizerWildEncounter
+{
+    u16 species;
+    u16 bst;
+    u16 finalEvoBST;
+    u16 index;
+    u32 typeMask;
+};
+
+static u16 SumBaseStats(u16 species)
+{
+    return gBaseStats[species].baseHP
+        + gBaseStats[species].baseAttack
+        + gBaseStats[species].baseDefense
+        + gBaseStats[species].baseSpeed
+        + gBaseStats[species].baseSpAttack
+        + gBaseStats[species].baseSpDefense;
+}
+
+// Follows the first evolution of species, ignoring Mega Evolution, for at most 5 steps.
+static u16 FollowFirstEvolutions(u16 species)
+{
+    int i;
+
+    for (i = 0; i < 5; i++)
+    {
+        if (gEvolutionTable[species][0].method == 0 || gEvolutionTable[species][0].method == EVO_MEGA_EVOLUTION)
+            break;
+        species = gEvolutionTable[species][0].targetSpecies;
+    }
+
+    return species;
+}
+
+static void WriteEggMovesIndex(FILE *fp)
+{
+    static bool8 found[NUM_SPECIES];
+    size_t i;
+    u16 species;
+    int count;
+
+    fprintf(fp, "static const struct EggMovesIndex sEggMovesIndex[NUM_SPECIES] =\n{\n");
+    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
+    {
+        if (gEggMoves[i] <= EGG_MOVES_SPECIES_OFFSET || gEggMoves[i] == EGG_MOVES_TERMINATOR)
+            continue;
+
+        // Only the first block of a species counts, and at most EGG_MOVES_ARRAY_COUNT
+        // of its moves, like the old scan of gEggMoves.
+        species = gEggMoves[i] - EGG_MOVES_SPECIES_OFFSET;
+        if (species >= NUM_SPECIES || found[species])
+            continue;
+        found[species] = TRUE;
+
+        for (count = 0; count < EGG_MOVES_ARRAY_COUNT; count++)
+        {
+            if (gEggMoves[i + 1 + count] > EGG_MOVES_SPECIES_OFFSET)
+                break;
+        }
+        if (count != 0)
+            fprintf(fp, "    [%u] = {%u, %u},\n", species, (unsigned)(i + 1), count);
+    }
+    fprintf(fp, "};\n");
+}
+
+static void WriteEvolutionTables(FILE *fp)
+{
+    static u16 preEvolutions[NUM_SPECIES];
+    u16 species, root, target;
+    int i, j, stage;
+
+    // The lowest species id that evolves into each species.
+    for (i = 1; i < NUM_SPECIES; i++)
+    {
+        for (j = 0; j < EVOS_PER_MON; j++)
+        {
+            target = gEvolutionTable[i][j].targetSpecies;
+            if (target != SPECIES_NONE && target < NUM_SPECIES && preEvolutions[target] == SPECIES_NONE)
+                preEvolutions[target] = i;
+        }
+    }
+
+    fprintf(fp, "const u16 gPreEvolutionTable[NUM_SPECIES] =\n{\n");
+    for (species = 0; species < NUM_SPECIES; species++)
+    {
+        if (preEvolutions[species] != SPECIES_NONE)
+            fprintf(fp, "    [%u] = %u,\n", species, preEvolutions[species]);
+    }
+    fprintf(fp, "};\n\n");
+
+    // The family root is found by walking back through the pre-evolutions, capped
+    // at EVOS_PER_MON steps in case of evolution loops.
+    fprintf(fp, "const struct EvolutionFamily gEvolutionFamily[NUM_SPECIES] =\n{\n");
+    for (species = 0; species < NUM_SPECIES; species++)
+    {
+        root = species;
+        for (stage = 0; stage < EVOS_PER_MON && preEvolutions[root] != SPECIES_NONE; stage++)
+            root = preEvolutions[root];
+        fprintf(fp, "    [%u] = {%u, %u, %u},\n", species, root, FollowFirstEvolutions(species), stage);
+    }
+    fprintf(fp, "};\n");
+}
+
+static int CompareWildEncounters(const void *a, const void *b)
+{
+    const struct RandomizerWildEncounter *encA = a;
+    const struct RandomizerWildEncounter *encB = b;
+
+    if (encA->bst != encB->bst)
+        return encA->bst < encB->bst ? -1 : 1;
+    return encA->index < encB->index ? -1 : 1;
+}
+
+static void WriteRandomizerTable(FILE *fp)
+{
+    static struct RandomizerWildEncounter encounters[ARRAY_COUNT(possibleWildEncounter)];
+    static u16 positions[ARRAY_COUNT(possibleWildEncounter)];
+    size_t i;
+    u16 species;
+
+    for (i = 0; i < ARRAY_COUNT(possibleWildEncounter); i++)
+    {
+        species = possibleWildEncounter[i][0];
+        encounters[i].species = species;
+        encounters[i].bst = SumBaseStats(species);
+        if (encounters[i].bst < RANDOMIZER_MIN_BST)
+            encounters[i].bst = RANDOMIZER_MIN_BST;
+        encounters[i].finalEvoBST = SumBaseStats(FollowFirstEvolutions(species));
+        encounters[i].index = i;
+        encounters[i].typeMask = (1 << gBaseStats[species].type1) | (1 << gBaseStats[species].type2);
+    }
+
+    qsort(encounters, ARRAY_COUNT(encounters), sizeof(encounters[0]), CompareWildEncounters);
+
+    fprintf(fp, "static const struct RandomizerWildEncounter sWildEncountersByBST[] =\n{\n");
+    for (i = 0; i < ARRAY_COUNT(encounters); i++)
+    {
+        fprintf(fp, "    {%u, %u, %u, %u, 0x%X},\n", encounters[i].species, encounters[i].bst,
+                encounters[i].finalEvoBST, encounters[i].index, encounters[i].typeMask);
+        positions[encounters[i].index] = i;
+    }
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "static const u16 sWildEncounterPositions[] =\n{\n");
+    for (i = 0; i < ARRAY_COUNT(positions); i++)
+        fprintf(fp, "    %u,\n", positions[i]);
+    fprintf(fp, "};\n");
+}
+
+static const struct
+{
+    const char *name;
+    void (*write)(FILE *fp);
+} sTables[] =
+{
+    {"eggmoves", WriteEggMovesIndex},
+    {"evolution", WriteEvolutionTables},
+    {"randomizer", WriteRandomizerTable},
+};
+
+int main(int argc, char **argv)
+{
+    FILE *fp;
+    size_t i;
+
+    if (argc != 3)
+        FATAL_ERROR("Usage: lookupgen TABLE OUTPUT_FILE\n");
+
+    for (i = 0; i < ARRAY_COUNT(sTables); i++)
+    {
+        if (strcmp(argv[1], sTables[i].name) == 0)
+            break;
+    }
+    if (i == ARRAY_COUNT(sTables))
+        FATAL_ERROR("Unknown table \"%s\".\n", argv[1]);
+
+    fp = fopen(argv[2], "w");
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", argv[2]);
+
+    fprintf(fp, "//\n// DO NOT MODIFY THIS FILE! It is auto-generated by tools/lookupgen from the species data.\n//\n\n");
+    sTables[i].write(fp);
+
+    fclose(fp);
+    return 0;
+}
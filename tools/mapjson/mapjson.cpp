@@ -12,6 +12,11 @@ using std::vector;
 #include <algorithm>
 using std::sort; using std::find;
 
+#include <tuple>
+using std::tuple; using std::make_tuple; using std::get;
+
+#include <cstdint>
+
 #include <map>
 using std::map;
 
@@ -158,7 +163,9 @@ string generate_map_events_text(Json map_data) {
          << map_data["name"].string_value() 
          << "/map.json\n@\n\n";
 
-    string objects_label, warps_label, coords_label, bgs_label;
+    string objects_label, warps_label, coords_label, bgs_label, positions_label;
+    // (y, x, kind, index) of every warp, coord and bg event, sorted for binary search at runtime.
+    vector<tuple<uint16_t, uint16_t, string, unsigned int>> positions;
 
     if (map_data["object_events"].array_items().size() > 0) {
         objects_label = map_data["name"].string_value() + "_ObjectEvents";
@@ -186,7 +193,9 @@ string generate_map_events_text(Json map_data) {
     if (map_data["warp_events"].array_items().size() > 0) {
         warps_label = map_data["name"].string_value() + "_MapWarps";
         text << warps_label << ":\n";
+        unsigned int warp_index = 0;
         for (auto &warp_event : map_data["warp_events"].array_items()) {
+            positions.push_back(make_tuple((uint16_t)warp_event["y"].int_value(), (uint16_t)warp_event["x"].int_value(), "MAP_EVENT_POSITION_WARP", warp_index++));
             text << "\twarp_def "
                  << warp_event["x"].int_value() << ", "
                  << warp_event["y"].int_value() << ", "
@@ -202,7 +211,10 @@ string generate_map_events_text(Json map_data) {
     if (map_data["coord_events"].array_items().size() > 0) {
         coords_label = map_data["name"].string_value() + "_MapCoordEvents";
         text << coords_label << ":\n";
+        unsigned int coord_index = 0;
         for (auto &coord_event : map_data["coord_events"].array_items()) {
+            if (coord_event["type"].string_value() == "trigger" || coord_event["type"] == "weather")
+                positions.push_back(make_tuple((uint16_t)coord_event["y"].int_value(), (uint16_t)coord_event["x"].int_value(), "MAP_EVENT_POSITION_COORD", coord_index++));
             if (coord_event["type"].string_value() == "trigger") {
                 text << "\tcoord_event "
                      << coord_event["x"].int_value() << ", "
@@ -228,7 +240,10 @@ string generate_map_events_text(Json map_data) {
     if (map_data["bg_events"].array_items().size() > 0) {
         bgs_label = map_data["name"].string_value() + "_MapBGEvents";
         text << bgs_label << ":\n";
+        unsigned int bg_index = 0;
         for (auto &bg_event : map_data["bg_events"].array_items()) {
+            if (bg_event["type"] == "sign" || bg_event["type"] == "hidden_item" || bg_event["type"] == "secret_base")
+                positions.push_back(make_tuple((uint16_t)bg_event["y"].int_value(), (uint16_t)bg_event["x"].int_value(), "MAP_EVENT_POSITION_BG", bg_index++));
             if (bg_event["type"] == "sign") {
                 text << "\tbg_event "
                      << bg_event["x"].int_value() << ", "
@@ -258,9 +273,25 @@ string generate_map_events_text(Json map_data) {
         bgs_label = "0x0";
     }
 
+    if (positions.size() > 0) {
+        positions_label = map_data["name"].string_value() + "_MapEventPositions";
+        sort(positions.begin(), positions.end());
+        text << positions_label << ":\n";
+        for (auto &position : positions) {
+            text << "\tmap_event_position "
+                 << get<1>(position) << ", "
+                 << get<0>(position) << ", "
+                 << get<2>(position) << ", "
+                 << get<3>(position) << "\n";
+        }
+        text << "\n";
+    } else {
+        positions_label = "0x0";
+    }
+
     text << map_data["name"].string_value() << "_MapEvents::\n"
          << "\tmap_events " << objects_label << ", " << warps_label << ", "
-         << coords_label << ", " << bgs_label << "\n\n";
+         << coords_label << ", " << bgs_label << ", " << positions_label << "\n\n";
 
     return text.str();
 }
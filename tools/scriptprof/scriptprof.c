@@ -0,0 +1,270 @@
+// scriptprof: annotates event script profiler output with symbol names
+//
+// Usage: scriptprof [--sort] SYM_FILE [LOG_FILE]
+//
+// Reads the "SCRPROF ..." lines printed by ScriptProfilerReport (see
+// include/config.h) from LOG_FILE or stdin and appends the name of the nearest
+// symbol to every ROM/RAM address, so script addresses show up as their
+// data/scripts labels and command/special handlers as their function names.
+// With --sort, the lines are ordered by their "lines=" value, largest first.
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+struct Symbol
+{
+    unsigned long address;
+    char *name;
+};
+
+struct Line
+{
+    char *text;
+    unsigned long cost;
+};
+
+static struct Symbol *sSymbols;
+static size_t sNumSymbols;
+
+static void *Realloc(void *ptr, size_t size)
+{
+    ptr = realloc(ptr, size);
+    if (ptr == NULL)
+        FATAL_ERROR("Out of memory.\n");
+    return ptr;
+}
+
+static char *Duplicate(const char *str)
+{
+    char *copy = Realloc(NULL, strlen(str) + 1);
+    strcpy(copy, str);
+    return copy;
+}
+
+static int CompareSymbols(const void *a, const void *b)
+{
+    const struct Symbol *symA = a;
+    const struct Symbol *symB = b;
+
+    if (symA->address != symB->address)
+        return symA->address < symB->address ? -1 : 1;
+    return strcmp(symA->name, symB->name);
+}
+
+// Section and local assembler labels make poor names for a profile.
+static bool IsUsefulSymbol(const char *name)
+{
+    return name[0] != '.' && name[0] != '$' && strncmp(name, "__", 2) != 0;
+}
+
+// Parses the .sym file produced by "make syms": ADDRESS TYPE SIZE NAME per line.
+static void ReadSymbols(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char line[1024];
+    size_t capacity = 0;
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        unsigned long address, size;
+        char type;
+        char name[512];
+
+        if (sscanf(line, "%lx %c %lx %511s", &address, &type, &size, name) != 4)
+            continue;
+        if (!IsUsefulSymbol(name))
+            continue;
+
+        if (sNumSymbols == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 4096;
+            sSymbols = Realloc(sSymbols, capacity * sizeof(*sSymbols));
+        }
+        sSymbols[sNumSymbols].address = address;
+        sSymbols[sNumSymbols].name = Duplicate(name);
+        sNumSymbols++;
+    }
+
+    fclose(fp);
+    qsort(sSymbols, sNumSymbols, sizeof(*sSymbols), CompareSymbols);
+}
+
+// Returns the last symbol at or below address, or NULL.
+static const struct Symbol *FindSymbol(unsigned long address)
+{
+    size_t lo = 0, hi = sNumSymbols;
+
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (sSymbols[mid].address <= address)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo == 0 ? NULL : &sSymbols[lo - 1];
+}
+
+static bool IsMappedAddress(unsigned long address)
+{
+    switch (address >> 24)
+    {
+    case 0x02:
+    case 0x03:
+    case 0x08:
+    case 0x09:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void PrintAddressName(FILE *out, unsigned long address)
+{
+    const struct Symbol *sym = FindSymbol(address);
+
+    if (sym == NULL)
+        return;
+
+    // Thumb function pointers have bit 0 set.
+    if (sym->address != address && (address & 1) && sym->address == (address & ~1UL))
+        address &= ~1UL;
+
+    if (sym->address == address)
+        fprintf(out, " (%s)", sym->name);
+    else
+        fprintf(out, " (%s+0x%lX)", sym->name, address - sym->address);
+}
+
+// Copies text to out, following every 8 digit hex word that looks like an
+// address with its symbol name.
+static void AnnotateLine(FILE *out, const char *text)
+{
+    const char *p = text;
+
+    while (*p != '\0')
+    {
+        size_t len = 0;
+
+        if (p == text || isspace((unsigned char)p[-1]))
+            while (isxdigit((unsigned char)p[len]))
+                len++;
+
+        if (len == 8 && (p[len] == '\0' || isspace((unsigned char)p[len])))
+        {
+            unsigned long address = strtoul(p, NULL, 16);
+
+            fwrite(p, 1, len, out);
+            if (IsMappedAddress(address))
+                PrintAddressName(out, address);
+            p += len;
+        }
+        else if (len != 0)
+        {
+            fwrite(p, 1, len, out);
+            p += len;
+        }
+        else
+        {
+            fputc(*p++, out);
+        }
+    }
+}
+
+static unsigned long GetLineCost(const char *text)
+{
+    const char *cost = strstr(text, "lines=");
+
+    return cost != NULL ? strtoul(cost + 6, NULL, 10) : 0;
+}
+
+static int CompareLines(const void *a, const void *b)
+{
+    const struct Line *lineA = a;
+    const struct Line *lineB = b;
+
+    if (lineA->cost != lineB->cost)
+        return lineA->cost > lineB->cost ? -1 : 1;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    bool sort = false;
+    int argi = 1;
+    FILE *in = stdin;
+    char buffer[1024];
+    struct Line *lines = NULL;
+    size_t numLines = 0, capacity = 0;
+
+    if (argi < argc && strcmp(argv[argi], "--sort") == 0)
+    {
+        sort = true;
+        argi++;
+    }
+
+    if (argi >= argc || argc - argi > 2)
+        FATAL_ERROR("Usage: scriptprof [--sort] SYM_FILE [LOG_FILE]\n");
+
+    ReadSymbols(argv[argi]);
+
+    if (argi + 1 < argc)
+    {
+        in = fopen(argv[argi + 1], "r");
+        if (in == NULL)
+            FATAL_ERROR("Failed to open \"%s\" for reading.\n", argv[argi + 1]);
+    }
+
+    while (fgets(buffer, sizeof(buffer), in) != NULL)
+    {
+        const char *start = strstr(buffer, "SCRPROF ");
+
+        if (start == NULL)
+            continue;
+
+        if (!sort)
+        {
+            AnnotateLine(stdout, start);
+            continue;
+        }
+
+        if (numLines == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 256;
+            lines = Realloc(lines, capacity * sizeof(*lines));
+        }
+        lines[numLines].text = Duplicate(start);
+        lines[numLines].cost = GetLineCost(start);
+        numLines++;
+    }
+
+    if (in != stdin)
+        fclose(in);
+
+    if (sort)
+    {
+        size_t i;
+
+        // qsort isn't stable, but equal costs have no meaningful order anyway.
+        qsort(lines, numLines, sizeof(*lines), CompareLines);
+        for (i = 0; i < numLines; i++)
+            AnnotateLine(stdout, lines[i].text);
+    }
+
+    return 0;
+}